@@ -74,6 +74,124 @@ void aria_dealloc(void* ptr, int64_t size) {
     }
 }
 
+/* ========================================================================
+ * Arena Allocator
+ * ======================================================================== */
+
+/* Default block size when aria_arena_create is passed 0 */
+#define ARIA_ARENA_DEFAULT_BLOCK_SIZE 4096
+
+/* All arena allocations are rounded up to this alignment */
+#define ARIA_ARENA_ALIGNMENT 8
+
+/* One block in the arena's chain; the payload follows the header */
+typedef struct AriaArenaBlock {
+    struct AriaArenaBlock* next;
+    int64_t capacity;  /* Payload bytes available in this block */
+    int64_t used;      /* Payload bytes handed out so far */
+} AriaArenaBlock;
+
+struct AriaArena {
+    AriaArenaBlock* head;     /* First block in the chain */
+    AriaArenaBlock* current;  /* Block new allocations bump into */
+    int64_t block_size;       /* Payload size for regular blocks */
+};
+
+/* Allocate a block with at least `capacity` payload bytes */
+static AriaArenaBlock* aria_arena_new_block(int64_t capacity) {
+    AriaArenaBlock* block = malloc(sizeof(AriaArenaBlock) + (size_t)capacity);
+    if (block == NULL) {
+        aria_panic("Out of memory: arena block allocation failed");
+    }
+    block->next = NULL;
+    block->capacity = capacity;
+    block->used = 0;
+    return block;
+}
+
+AriaArena* aria_arena_create(int64_t block_size) {
+    if (block_size <= 0) {
+        block_size = ARIA_ARENA_DEFAULT_BLOCK_SIZE;
+    }
+
+    AriaArena* arena = malloc(sizeof(AriaArena));
+    if (arena == NULL) {
+        aria_panic("Out of memory: arena creation failed");
+    }
+
+    arena->block_size = block_size;
+    arena->head = aria_arena_new_block(block_size);
+    arena->current = arena->head;
+
+    return arena;
+}
+
+void* aria_arena_alloc(AriaArena* arena, int64_t size) {
+    if (arena == NULL || size <= 0) {
+        return NULL;
+    }
+
+    /* Round up so the next allocation stays aligned */
+    int64_t aligned = (size + (ARIA_ARENA_ALIGNMENT - 1))
+                      & ~(int64_t)(ARIA_ARENA_ALIGNMENT - 1);
+
+    /* After a reset the chain may already hold a block big enough */
+    AriaArenaBlock* block = arena->current;
+    while (block->capacity - block->used < aligned && block->next != NULL) {
+        block = block->next;
+    }
+
+    if (block->capacity - block->used < aligned) {
+        /* Oversized requests get a dedicated block of their own */
+        int64_t capacity = aligned > arena->block_size ? aligned : arena->block_size;
+        block->next = aria_arena_new_block(capacity);
+        block = block->next;
+    }
+
+    arena->current = block;
+    char* ptr = (char*)(block + 1) + block->used;
+    block->used += aligned;
+    return ptr;
+}
+
+char* aria_arena_strdup(AriaArena* arena, const char* str) {
+    if (arena == NULL) {
+        return NULL;
+    }
+    if (str == NULL) str = "";
+
+    size_t len = strlen(str);
+    char* copy = aria_arena_alloc(arena, (int64_t)len + 1);
+    memcpy(copy, str, len + 1);
+    return copy;
+}
+
+void aria_arena_reset(AriaArena* arena) {
+    if (arena == NULL) {
+        return;
+    }
+
+    /* Keep every block for reuse; just rewind the bump cursors */
+    for (AriaArenaBlock* block = arena->head; block != NULL; block = block->next) {
+        block->used = 0;
+    }
+    arena->current = arena->head;
+}
+
+void aria_arena_destroy(AriaArena* arena) {
+    if (arena == NULL) {
+        return;
+    }
+
+    AriaArenaBlock* block = arena->head;
+    while (block != NULL) {
+        AriaArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    free(arena);
+}
+
 /* ========================================================================
  * String Operations
  * ======================================================================== */
@@ -323,6 +441,226 @@ int32_t aria_char_at(const char* str, int64_t index) {
     return (int32_t)(unsigned char)str[index];
 }
 
+/* ========================================================================
+ * String Builder
+ * ======================================================================== */
+
+/* Default buffer size when aria_builder_new is passed 0 */
+#define ARIA_BUILDER_DEFAULT_CAPACITY 64
+
+/* Grow the buffer until it can hold `needed` more bytes plus the terminator */
+static void aria_builder_reserve(AriaStringBuilder* builder, int64_t needed) {
+    int64_t required = builder->length + needed + 1;
+    if (required <= builder->capacity) {
+        return;
+    }
+
+    int64_t capacity = builder->capacity;
+    while (capacity < required) {
+        capacity *= 2;
+    }
+
+    char* data = realloc(builder->data, (size_t)capacity);
+    if (data == NULL) {
+        aria_panic("Out of memory: string builder growth failed");
+    }
+    builder->data = data;
+    builder->capacity = capacity;
+}
+
+AriaStringBuilder* aria_builder_new(int64_t capacity) {
+    if (capacity <= 0) {
+        capacity = ARIA_BUILDER_DEFAULT_CAPACITY;
+    }
+
+    AriaStringBuilder* builder = malloc(sizeof(AriaStringBuilder));
+    if (builder == NULL) {
+        aria_panic("Out of memory: string builder creation failed");
+    }
+
+    builder->data = malloc((size_t)capacity);
+    if (builder->data == NULL) {
+        aria_panic("Out of memory: string builder creation failed");
+    }
+    builder->data[0] = '\0';
+    builder->length = 0;
+    builder->capacity = capacity;
+
+    return builder;
+}
+
+void aria_builder_free(AriaStringBuilder* builder) {
+    if (builder != NULL) {
+        free(builder->data);
+        free(builder);
+    }
+}
+
+void aria_builder_append_len(AriaStringBuilder* builder, const char* str,
+                             int64_t length) {
+    if (builder == NULL || str == NULL || length <= 0) {
+        return;
+    }
+
+    aria_builder_reserve(builder, length);
+    memcpy(builder->data + builder->length, str, (size_t)length);
+    builder->length += length;
+    builder->data[builder->length] = '\0';
+}
+
+void aria_builder_append(AriaStringBuilder* builder, const char* str) {
+    if (str == NULL) {
+        return;
+    }
+    aria_builder_append_len(builder, str, (int64_t)strlen(str));
+}
+
+void aria_builder_append_char(AriaStringBuilder* builder, int32_t value) {
+    char c = (char)value;
+    aria_builder_append_len(builder, &c, 1);
+}
+
+void aria_builder_append_int(AriaStringBuilder* builder, int64_t value) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%lld", (long long)value);
+    aria_builder_append(builder, buffer);
+}
+
+void aria_builder_append_float(AriaStringBuilder* builder, double value) {
+    /* Same formatting as aria_float_to_string: %.6f with trailing zeros
+     * stripped, but written in place instead of via a heap string */
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.6f", value);
+
+    char* dot = strchr(buffer, '.');
+    if (dot != NULL) {
+        char* end = buffer + strlen(buffer) - 1;
+        while (end > dot && *end == '0') {
+            *end = '\0';
+            end--;
+        }
+        if (end == dot) {
+            *dot = '\0';
+        }
+    }
+
+    aria_builder_append(builder, buffer);
+}
+
+void aria_builder_append_substring(AriaStringBuilder* builder, const char* str,
+                                   int64_t start, int64_t length) {
+    if (builder == NULL || str == NULL) {
+        return;
+    }
+
+    /* Same clamping as aria_string_substring */
+    size_t str_len = strlen(str);
+    if (start < 0) start = 0;
+    if ((size_t)start >= str_len) {
+        return;
+    }
+    if (length < 0) length = 0;
+    if ((size_t)(start + length) > str_len) {
+        length = (int64_t)(str_len - (size_t)start);
+    }
+
+    aria_builder_append_len(builder, str + start, length);
+}
+
+void aria_builder_append_replace(AriaStringBuilder* builder, const char* str,
+                                 const char* from, const char* to) {
+    if (builder == NULL || str == NULL || from == NULL || to == NULL) {
+        return;
+    }
+
+    size_t from_len = strlen(from);
+    if (from_len == 0) {
+        aria_builder_append(builder, str);
+        return;
+    }
+
+    int64_t to_len = (int64_t)strlen(to);
+    const char* p = str;
+    const char* next;
+    while ((next = strstr(p, from)) != NULL) {
+        aria_builder_append_len(builder, p, (int64_t)(next - p));
+        aria_builder_append_len(builder, to, to_len);
+        p = next + from_len;
+    }
+    aria_builder_append(builder, p);
+}
+
+void aria_builder_append_upper(AriaStringBuilder* builder, const char* str) {
+    if (builder == NULL || str == NULL) {
+        return;
+    }
+
+    int64_t len = (int64_t)strlen(str);
+    aria_builder_reserve(builder, len);
+
+    char* dest = builder->data + builder->length;
+    for (int64_t i = 0; i < len; i++) {
+        char c = str[i];
+        dest[i] = (c >= 'a' && c <= 'z') ? c - 32 : c;
+    }
+    builder->length += len;
+    builder->data[builder->length] = '\0';
+}
+
+void aria_builder_append_lower(AriaStringBuilder* builder, const char* str) {
+    if (builder == NULL || str == NULL) {
+        return;
+    }
+
+    int64_t len = (int64_t)strlen(str);
+    aria_builder_reserve(builder, len);
+
+    char* dest = builder->data + builder->length;
+    for (int64_t i = 0; i < len; i++) {
+        char c = str[i];
+        dest[i] = (c >= 'A' && c <= 'Z') ? c + 32 : c;
+    }
+    builder->length += len;
+    builder->data[builder->length] = '\0';
+}
+
+const char* aria_builder_view(const AriaStringBuilder* builder) {
+    if (builder == NULL) {
+        return "";
+    }
+    return builder->data;
+}
+
+char* aria_builder_to_string(const AriaStringBuilder* builder) {
+    if (builder == NULL) {
+        char* empty = malloc(1);
+        if (empty == NULL) {
+            aria_panic("Out of memory: string builder copy failed");
+        }
+        empty[0] = '\0';
+        return empty;
+    }
+
+    char* result = malloc((size_t)builder->length + 1);
+    if (result == NULL) {
+        aria_panic("Out of memory: string builder copy failed");
+    }
+    memcpy(result, builder->data, (size_t)builder->length + 1);
+    return result;
+}
+
+int64_t aria_builder_length(const AriaStringBuilder* builder) {
+    return builder == NULL ? 0 : builder->length;
+}
+
+void aria_builder_clear(AriaStringBuilder* builder) {
+    if (builder == NULL) {
+        return;
+    }
+    builder->length = 0;
+    builder->data[0] = '\0';
+}
+
 /* ========================================================================
  * Type Conversion Functions
  * ======================================================================== */
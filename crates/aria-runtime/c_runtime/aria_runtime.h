@@ -67,6 +67,57 @@ void* aria_alloc(int64_t size);
  */
 void aria_dealloc(void* ptr, int64_t size);
 
+/* ========================================================================
+ * Arena Allocator
+ * ======================================================================== */
+
+/**
+ * Region allocator: allocations are bump-pointer cheap and are all
+ * released together by reset or destroy, with no per-allocation free.
+ * Compiled code uses one arena per phase (e.g. per report section) so
+ * temporary strings stop going through malloc/free individually.
+ * The struct is opaque; use the functions below.
+ */
+typedef struct AriaArena AriaArena;
+
+/**
+ * Create a new arena.
+ * @param block_size Bytes per internal block (0 picks a default);
+ *                   allocations larger than this get a dedicated block
+ * @return The new arena (never NULL; panics on allocation failure)
+ */
+AriaArena* aria_arena_create(int64_t block_size);
+
+/**
+ * Allocate from an arena. The memory is valid until the arena is
+ * reset or destroyed; there is no per-allocation free.
+ * @param arena The arena
+ * @param size Number of bytes (returned pointer is 8-byte aligned)
+ * @return Pointer into the arena, or NULL if size <= 0
+ */
+void* aria_arena_alloc(AriaArena* arena, int64_t size);
+
+/**
+ * Copy a string into an arena.
+ * @param arena The arena
+ * @param str The string (NULL is treated as empty)
+ * @return Arena-owned null-terminated copy
+ */
+char* aria_arena_strdup(AriaArena* arena, const char* str);
+
+/**
+ * Release every allocation at once but keep the arena's blocks for
+ * reuse, so the next phase allocates without touching malloc.
+ * @param arena The arena
+ */
+void aria_arena_reset(AriaArena* arena);
+
+/**
+ * Free the arena and all its blocks.
+ * @param arena The arena (NULL is a no-op)
+ */
+void aria_arena_destroy(AriaArena* arena);
+
 /* ========================================================================
  * String Operations
  * ======================================================================== */
@@ -166,6 +217,83 @@ char* aria_string_to_lower(const char* str);
  */
 int32_t aria_char_at(const char* str, int64_t index);
 
+/* ========================================================================
+ * String Builder
+ * ======================================================================== */
+
+/**
+ * Incremental string builder backed by one doubling buffer, so a loop
+ * that assembles output line-by-line costs amortized O(n) instead of
+ * the O(n^2) of repeated aria_string_concat. The append variants below
+ * mirror the allocating string helpers but write straight into the
+ * builder, with no intermediate heap string.
+ */
+typedef struct {
+    char* data;        /* Null-terminated contents */
+    int64_t length;    /* Bytes used, excluding the terminator */
+    int64_t capacity;  /* Allocated bytes, including the terminator */
+} AriaStringBuilder;
+
+/**
+ * Create a new string builder.
+ * @param capacity Initial buffer size in bytes (0 picks a default)
+ * @return The new builder (never NULL; panics on allocation failure)
+ */
+AriaStringBuilder* aria_builder_new(int64_t capacity);
+
+/** Free a builder and its buffer (NULL is a no-op) */
+void aria_builder_free(AriaStringBuilder* builder);
+
+/** Append a string (NULL is treated as empty) */
+void aria_builder_append(AriaStringBuilder* builder, const char* str);
+
+/** Append the first length bytes of str */
+void aria_builder_append_len(AriaStringBuilder* builder, const char* str,
+                             int64_t length);
+
+/** Append a single character code */
+void aria_builder_append_char(AriaStringBuilder* builder, int32_t value);
+
+/** Append the decimal form of an integer */
+void aria_builder_append_int(AriaStringBuilder* builder, int64_t value);
+
+/** Append the shortest form of a float (matches aria_float_to_string) */
+void aria_builder_append_float(AriaStringBuilder* builder, double value);
+
+/** Append a substring of str (same clamping as aria_string_substring) */
+void aria_builder_append_substring(AriaStringBuilder* builder, const char* str,
+                                   int64_t start, int64_t length);
+
+/** Append str with every occurrence of from replaced by to */
+void aria_builder_append_replace(AriaStringBuilder* builder, const char* str,
+                                 const char* from, const char* to);
+
+/** Append str converted to uppercase */
+void aria_builder_append_upper(AriaStringBuilder* builder, const char* str);
+
+/** Append str converted to lowercase */
+void aria_builder_append_lower(AriaStringBuilder* builder, const char* str);
+
+/**
+ * Borrow the builder's contents without copying.
+ * @return Null-terminated string owned by the builder; valid until the
+ *         next append, clear or free
+ */
+const char* aria_builder_view(const AriaStringBuilder* builder);
+
+/**
+ * Copy the contents out as an independent heap string.
+ * @return Newly allocated string (caller must free); the builder keeps
+ *         its contents
+ */
+char* aria_builder_to_string(const AriaStringBuilder* builder);
+
+/** Get the current length in bytes */
+int64_t aria_builder_length(const AriaStringBuilder* builder);
+
+/** Empty the builder but keep its buffer for reuse */
+void aria_builder_clear(AriaStringBuilder* builder);
+
 /* ========================================================================
  * Type Conversion Functions
  * ======================================================================== */
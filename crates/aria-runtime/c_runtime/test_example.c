@@ -77,6 +77,43 @@ void aria_main(void) {
     aria_print_string("Freed memory");
     aria_print_newline();
 
+    // Test arena allocator
+    aria_print_newline();
+    aria_print_string("=== Arena Allocator ===");
+    aria_print_newline();
+
+    AriaArena* arena = aria_arena_create(0);
+    char* arena_copy = aria_arena_strdup(arena, "lives in the arena");
+    aria_print_string("Arena string: ");
+    aria_print_string(arena_copy);
+    aria_print_newline();
+
+    aria_arena_reset(arena);
+    aria_print_string("Arena reset; blocks kept for reuse");
+    aria_print_newline();
+    aria_arena_destroy(arena);
+
+    // Test string builder
+    aria_print_newline();
+    aria_print_string("=== String Builder ===");
+    aria_print_newline();
+
+    AriaStringBuilder* sb = aria_builder_new(0);
+    aria_builder_append(sb, "line ");
+    aria_builder_append_int(sb, 1);
+    aria_builder_append_char(sb, ':');
+    aria_builder_append_char(sb, ' ');
+    aria_builder_append_upper(sb, "built ");
+    aria_builder_append_replace(sb, "piece by piece", "piece", "part");
+    aria_print_string("Built: ");
+    aria_print_string(aria_builder_view(sb));
+    aria_print_newline();
+
+    aria_print_string("Length: ");
+    aria_print_int(aria_builder_length(sb));
+    aria_print_newline();
+    aria_builder_free(sb);
+
     // Success message
     aria_print_newline();
     aria_print_string("All tests completed successfully!");
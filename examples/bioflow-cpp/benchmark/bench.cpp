@@ -4,9 +4,12 @@
 #include "bioflow/alignment.hpp"
 #include "bioflow/quality.hpp"
 #include "bioflow/stats.hpp"
+#include "bioflow/io.hpp"
+#include "bioflow/decompress.hpp"
 
 #include <random>
 #include <string>
+#include <vector>
 
 using namespace bioflow;
 
@@ -81,6 +84,32 @@ static void BM_GCContentLarge(benchmark::State& state) {
 }
 BENCHMARK(BM_GCContentLarge);
 
+static void BM_BaseComposition(benchmark::State& state) {
+    auto bases = generateRandomSequence(static_cast<size_t>(state.range(0)));
+    Sequence seq(bases);
+
+    for (auto _ : state) {
+        auto counts = seq.baseComposition();
+        benchmark::DoNotOptimize(counts);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BaseComposition)->Range(100, 100000);
+
+static void BM_CountBase(benchmark::State& state) {
+    auto bases = generateRandomSequence(static_cast<size_t>(state.range(0)));
+    Sequence seq(bases);
+
+    for (auto _ : state) {
+        auto count = seq.countBase('G');
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CountBase)->Range(100, 100000);
+
 static void BM_Complement(benchmark::State& state) {
     auto bases = generateRandomSequence(static_cast<size_t>(state.range(0)));
     Sequence seq(bases);
@@ -140,6 +169,21 @@ static void BM_KMerCounting(benchmark::State& state) {
 }
 BENCHMARK(BM_KMerCounting)->Arg(5)->Arg(11)->Arg(21)->Arg(31);
 
+static void BM_EncodedKMerCounting(benchmark::State& state) {
+    size_t k = static_cast<size_t>(state.range(0));
+    auto bases = generateRepeatingSequence(20000);
+    Sequence seq(bases);
+
+    for (auto _ : state) {
+        EncodedKMerCounter counter(k);
+        counter.count(seq);
+        benchmark::DoNotOptimize(counter);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EncodedKMerCounting)->Arg(5)->Arg(11)->Arg(21)->Arg(31);
+
 static void BM_KMerCountingLarge(benchmark::State& state) {
     // Standard benchmark: 20000 bp sequence, k=21
     auto bases = generateRepeatingSequence(20000);
@@ -217,6 +261,21 @@ static void BM_SmithWatermanStandard(benchmark::State& state) {
 }
 BENCHMARK(BM_SmithWatermanStandard);
 
+static void BM_StripedSmithWaterman(benchmark::State& state) {
+    // Read-vs-contig shape: short query against a long target
+    auto bases1 = generateRandomSequence(150, 42);
+    auto bases2 = generateRandomSequence(static_cast<size_t>(state.range(0)), 123);
+    Sequence seq1(bases1), seq2(bases2);
+
+    for (auto _ : state) {
+        auto alignment = smithWatermanSIMD(seq1, seq2);
+        benchmark::DoNotOptimize(alignment);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StripedSmithWaterman)->Range(1000, 50000);
+
 static void BM_NeedlemanWunsch(benchmark::State& state) {
     size_t len = static_cast<size_t>(state.range(0));
     auto bases1 = generateRandomSequence(len, 42);
@@ -390,6 +449,255 @@ static void BM_SequenceAllocation(benchmark::State& state) {
 }
 BENCHMARK(BM_SequenceAllocation)->Range(10, 10000);
 
+// ============================================================================
+// Realistic Data Shapes
+// ============================================================================
+
+// Production inputs come in three shapes: 150 bp short reads, ~10 kb
+// long reads and ~1 Mb assembled contigs. The benchmarks below use
+// those sizes so numbers track what the pipeline actually sees.
+
+static std::vector<QualifiedSequence> generateReads(size_t count,
+                                                    size_t length,
+                                                    unsigned seed = 7) {
+    std::mt19937 rng(seed);
+    std::vector<QualifiedSequence> reads;
+    reads.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string quality;
+        quality.reserve(length);
+        for (size_t b = 0; b < length; ++b) {
+            quality += static_cast<char>('!' + 20 + rng() % 20);
+        }
+        reads.push_back(QualifiedSequence{
+            std::string("read_") + std::to_string(i),
+            generateRandomSequence(length, seed + static_cast<unsigned>(i) + 1),
+            QualityScores(quality),
+            std::nullopt});
+    }
+    return reads;
+}
+
+static std::string generateFastqText(size_t count, size_t length) {
+    auto reads = generateReads(count, length);
+    std::string text;
+    for (size_t i = 0; i < reads.size(); ++i) {
+        text += '@';
+        text += reads[i].id.view();
+        text += '\n';
+        text += reads[i].bases;
+        text += "\n+\n";
+        for (uint8_t score : reads[i].quality.scores()) {
+            text += static_cast<char>('!' + score);
+        }
+        text += '\n';
+    }
+    return text;
+}
+
+// ============================================================================
+// Quality Report Benchmarks
+// ============================================================================
+
+static void BM_QualityReportShortReads(benchmark::State& state) {
+    auto reads = generateReads(2000, 150);
+
+    for (auto _ : state) {
+        auto report = generateQualityReport(reads, static_cast<size_t>(state.range(0)));
+        benchmark::DoNotOptimize(report);
+    }
+
+    state.SetBytesProcessed(state.iterations() * 2000 * 150);
+}
+BENCHMARK(BM_QualityReportShortReads)->Arg(1)->Arg(2)->Arg(4);
+
+static void BM_TrimShortReads(benchmark::State& state) {
+    auto reads = generateReads(2000, 150);
+
+    for (auto _ : state) {
+        size_t survivors = 0;
+        for (const auto& read : reads) {
+            auto trimmed = read.trim(25, 50);
+            survivors += trimmed.length() > 0;
+        }
+        benchmark::DoNotOptimize(survivors);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2000);
+}
+BENCHMARK(BM_TrimShortReads);
+
+// ============================================================================
+// Collection Statistics Benchmarks
+// ============================================================================
+
+static void BM_CollectionStatsContigs(benchmark::State& state) {
+    std::vector<Sequence> contigs;
+    for (unsigned i = 0; i < 4; ++i) {
+        contigs.emplace_back(generateRandomSequence(1'000'000, 100 + i));
+    }
+
+    for (auto _ : state) {
+        auto stats = stats::computeCollectionStats(
+            contigs, static_cast<size_t>(state.range(0)));
+        benchmark::DoNotOptimize(stats);
+    }
+
+    state.SetBytesProcessed(state.iterations() * 4 * 1'000'000);
+}
+BENCHMARK(BM_CollectionStatsContigs)->Arg(1)->Arg(2)->Arg(4);
+
+static void BM_N50(benchmark::State& state) {
+    std::mt19937 rng(19);
+    std::vector<size_t> lengths(static_cast<size_t>(state.range(0)));
+    for (auto& length : lengths) {
+        length = 500 + rng() % 100000;
+    }
+
+    for (auto _ : state) {
+        auto n50 = stats::computeN50L50(lengths);
+        benchmark::DoNotOptimize(n50);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_N50)->Range(1000, 100000);
+
+// ============================================================================
+// I/O and Decompression Benchmarks
+// ============================================================================
+
+static void BM_FastqParseShortReads(benchmark::State& state) {
+    auto text = generateFastqText(2000, 150);
+
+    for (auto _ : state) {
+        FastqReader reader{std::string_view(text)};
+        FastqRecord record;
+        size_t records = 0;
+        while (reader.next(record)) {
+            ++records;
+        }
+        benchmark::DoNotOptimize(records);
+    }
+
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_FastqParseShortReads);
+
+static void BM_BgzfParallelDecompress(benchmark::State& state) {
+    auto text = generateFastqText(4000, 150);
+    auto compressed = compressBgzf(text);
+
+    for (auto _ : state) {
+        auto inflated = decompressBgzfParallel(
+            compressed, static_cast<size_t>(state.range(0)));
+        benchmark::DoNotOptimize(inflated);
+    }
+
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_BgzfParallelDecompress)->Arg(1)->Arg(2)->Arg(4);
+
+static void BM_CompressedFastqRead(benchmark::State& state) {
+    auto text = generateFastqText(2000, 150);
+    auto compressed = compressGzip(text);
+
+    for (auto _ : state) {
+        CompressedFastqReader reader{std::string_view(compressed)};
+        size_t records = 0;
+        while (auto record = reader.next()) {
+            ++records;
+        }
+        benchmark::DoNotOptimize(records);
+    }
+
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_CompressedFastqRead);
+
+// ============================================================================
+// Banded and Bounded Alignment Benchmarks
+// ============================================================================
+
+static void BM_BandedSmithWatermanLongRead(benchmark::State& state) {
+    std::string bases = generateRandomSequence(10000, 51);
+    std::string mutated = bases;
+    for (size_t i = 200; i < mutated.size(); i += 500) {
+        mutated[i] = mutated[i] == 'A' ? 'C' : 'A';
+    }
+    Sequence seq1(bases);
+    Sequence seq2(mutated);
+
+    for (auto _ : state) {
+        auto result = bandedSmithWaterman(seq1, seq2, 64);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BandedSmithWatermanLongRead);
+
+static void BM_EditDistanceWithinShortReads(benchmark::State& state) {
+    auto reads = generateReads(64, 150, 23);
+
+    for (auto _ : state) {
+        size_t near = 0;
+        for (size_t i = 1; i < reads.size(); ++i) {
+            Sequence seq1(reads[i - 1].bases);
+            Sequence seq2(reads[i].bases);
+            near += editDistanceWithin(seq1, seq2, 4).has_value();
+        }
+        benchmark::DoNotOptimize(near);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 63);
+}
+// The deduplication stage shards read pairs across threads; each
+// benchmark thread runs its own pair stream
+BENCHMARK(BM_EditDistanceWithinShortReads)->Threads(1)->Threads(2)->Threads(4);
+
+static void BM_MultipleAlignmentAmplicons(benchmark::State& state) {
+    std::mt19937 rng(27);
+    std::string reference = generateRandomSequence(150, 29);
+    std::vector<Sequence> sequences;
+    for (size_t v = 0; v < 16; ++v) {
+        std::string variant = reference;
+        variant[rng() % variant.size()] = "ACGT"[rng() % 4];
+        sequences.emplace_back(variant);
+    }
+
+    for (auto _ : state) {
+        auto rows = multipleAlignment(sequences, ScoringMatrix{},
+                                      static_cast<size_t>(state.range(0)));
+        benchmark::DoNotOptimize(rows);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+BENCHMARK(BM_MultipleAlignmentAmplicons)->Arg(1)->Arg(2);
+
+// ============================================================================
+// Multi-Threaded K-mer Counting
+// ============================================================================
+
+static void BM_KMerCountingThreaded(benchmark::State& state) {
+    // One private counter per thread, like the pipeline's per-worker
+    // tables that are merged at the end
+    auto reads = generateReads(500, 150,
+                               static_cast<unsigned>(37 + state.thread_index()));
+
+    for (auto _ : state) {
+        EncodedKMerCounter counter(21);
+        for (const auto& read : reads) {
+            counter.countRaw(read.bases);
+        }
+        benchmark::DoNotOptimize(counter.uniqueCount());
+    }
+
+    state.SetBytesProcessed(state.iterations() * 500 * 150);
+}
+BENCHMARK(BM_KMerCountingThreaded)->Threads(1)->Threads(2)->Threads(4);
+
 // ============================================================================
 // Main
 // ============================================================================
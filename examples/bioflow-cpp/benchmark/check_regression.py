@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Compare a benchmark run against a stored baseline.
+
+Both files are Google Benchmark JSON output (--benchmark_format=json).
+Benchmarks are matched by name and compared on real_time; the script
+exits non-zero if any benchmark is slower than the baseline by more
+than the tolerance, so it can gate vendor drops in CI:
+
+    ./bioflow_bench --benchmark_format=json --benchmark_out=baseline.json
+    ...apply the new drop, rebuild...
+    ./bioflow_bench --benchmark_format=json --benchmark_out=current.json
+    ./check_regression.py baseline.json current.json --tolerance 0.05
+
+Benchmarks present in only one file are reported but never fail the
+gate, so adding or retiring benchmarks does not break the comparison.
+"""
+
+import argparse
+import json
+import sys
+
+TIME_UNIT_NS = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_times(path):
+    with open(path) as handle:
+        data = json.load(handle)
+    times = {}
+    for entry in data.get("benchmarks", []):
+        # Skip aggregate rows (mean/median/stddev) from repeated runs
+        if entry.get("run_type", "iteration") != "iteration":
+            continue
+        times[entry["name"]] = (
+            entry["real_time"] * TIME_UNIT_NS[entry.get("time_unit", "ns")]
+        )
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", help="baseline benchmark JSON")
+    parser.add_argument("current", help="current benchmark JSON")
+    parser.add_argument(
+        "--tolerance",
+        type=float,
+        default=0.05,
+        help="allowed slowdown fraction before failing (default 0.05)",
+    )
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline)
+    current = load_times(args.current)
+
+    regressions = []
+    shared = sorted(set(baseline) & set(current))
+    width = max((len(name) for name in shared), default=0)
+    for name in shared:
+        delta = (current[name] - baseline[name]) / baseline[name]
+        marker = ""
+        if delta > args.tolerance:
+            marker = "  REGRESSION"
+            regressions.append(name)
+        print(f"{name:<{width}}  {delta:+7.1%}{marker}")
+
+    for name in sorted(set(baseline) - set(current)):
+        print(f"{name:<{width}}  missing from current run")
+    for name in sorted(set(current) - set(baseline)):
+        print(f"{name:<{width}}  not in baseline")
+
+    if regressions:
+        print(
+            f"\n{len(regressions)} benchmark(s) regressed more than "
+            f"{args.tolerance:.0%}",
+            file=sys.stderr,
+        )
+        return 1
+    print(f"\nno benchmark regressed more than {args.tolerance:.0%}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -2,6 +2,7 @@
 
 #include "bioflow/sequence.hpp"
 #include <memory>
+#include <span>
 #include <vector>
 #include <optional>
 #include <functional>
@@ -129,6 +130,32 @@ struct Alignment {
     const ScoringMatrix& scoring = ScoringMatrix{}
 );
 
+/**
+ * @brief Vectorized striped Smith-Waterman local alignment (Farrar)
+ *
+ * Computes the same local alignment as smithWaterman() using a striped
+ * SIMD layout: a saturating 8-bit first pass covers typical read-scale
+ * scores and automatically re-runs in 16-bit lanes when the score range
+ * overflows. The score pass locates the alignment end, a reversed pass
+ * locates the start, and the traceback runs the scalar DP only inside
+ * that window, so the O(mn) fill is fully vectorized.
+ *
+ * Falls back to the scalar implementation when SSE2 is unavailable.
+ * The scalar path remains the correctness oracle: scores are identical,
+ * and the returned alignment is an optimal (possibly co-optimal)
+ * traceback under the same scoring.
+ *
+ * @param seq1 First sequence (query)
+ * @param seq2 Second sequence (target)
+ * @param scoring Scoring parameters
+ * @return Alignment result with traceback
+ */
+[[nodiscard]] Alignment smithWatermanSIMD(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    const ScoringMatrix& scoring = ScoringMatrix{}
+);
+
 /**
  * @brief Needleman-Wunsch global alignment algorithm
  *
@@ -146,6 +173,69 @@ struct Alignment {
     const ScoringMatrix& scoring = ScoringMatrix{}
 );
 
+/**
+ * @brief Linear-space (Hirschberg) global alignment
+ *
+ * Computes the same optimal global alignment score as needlemanWunsch()
+ * using divide-and-conquer over forward and reverse score rows, so the
+ * working set is O(m + n) instead of the full (m+1)x(n+1) matrices.
+ * This makes contig-scale global alignments feasible where the direct
+ * DP would need terabytes of score and traceback cells.
+ *
+ * needlemanWunsch() dispatches here automatically once the full
+ * matrices would exceed a fixed memory budget; call this directly to
+ * force the linear-space mode. In the presence of co-optimal
+ * alignments the traceback may differ from the direct DP, but the
+ * score is always identical.
+ *
+ * @param seq1 First sequence
+ * @param seq2 Second sequence
+ * @param scoring Scoring parameters
+ * @return Alignment result with traceback
+ */
+[[nodiscard]] Alignment needlemanWunschLinear(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    const ScoringMatrix& scoring = ScoringMatrix{}
+);
+
+/**
+ * @brief Smith-Waterman with affine gap penalties (Gotoh)
+ *
+ * Three-matrix local alignment: opening a gap costs gap_open_penalty
+ * and each additional gapped base costs gap_extend_penalty, matching
+ * ScoringMatrix::gapPenalty(size_t). Use this instead of re-scoring a
+ * linear-gap alignment when gap structure matters biologically.
+ *
+ * @param seq1 First sequence
+ * @param seq2 Second sequence
+ * @param scoring Scoring parameters
+ * @return Alignment result with traceback
+ */
+[[nodiscard]] Alignment smithWatermanAffine(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    const ScoringMatrix& scoring = ScoringMatrix{}
+);
+
+/**
+ * @brief Needleman-Wunsch with affine gap penalties (Gotoh)
+ *
+ * Global counterpart of smithWatermanAffine(): same three-matrix
+ * recurrence with gap costs gap_open_penalty + (len-1) *
+ * gap_extend_penalty applied natively in the DP.
+ *
+ * @param seq1 First sequence
+ * @param seq2 Second sequence
+ * @param scoring Scoring parameters
+ * @return Alignment result with traceback
+ */
+[[nodiscard]] Alignment needlemanWunschAffine(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    const ScoringMatrix& scoring = ScoringMatrix{}
+);
+
 /**
  * @brief Semi-global alignment (fitting alignment)
  *
@@ -166,6 +256,11 @@ struct Alignment {
 /**
  * @brief Compute edit distance (Levenshtein distance) between sequences
  *
+ * When the shorter sequence fits in a machine word (<= 64 bases) the
+ * distance is computed with Myers' bit-parallel algorithm, which
+ * processes a whole DP column per word operation; longer inputs fall
+ * back to the two-row DP.
+ *
  * @param seq1 First sequence
  * @param seq2 Second sequence
  * @return Edit distance (minimum number of edits to transform seq1 into seq2)
@@ -175,9 +270,30 @@ struct Alignment {
     const Sequence& seq2
 );
 
+/**
+ * @brief Edit distance, bounded for read deduplication
+ *
+ * Computes only the 2*max_dist+1 diagonal band of the DP and stops as
+ * soon as every cell in a row exceeds the bound, so rejecting a
+ * dissimilar pair costs O(max_dist * min(m, n)) instead of O(mn).
+ *
+ * @param seq1 First sequence
+ * @param seq2 Second sequence
+ * @param max_dist Largest distance of interest
+ * @return The distance when it is <= max_dist, std::nullopt otherwise
+ */
+[[nodiscard]] std::optional<size_t> editDistanceWithin(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    size_t max_dist
+);
+
 /**
  * @brief Compute Hamming distance between equal-length sequences
  *
+ * Compares 16-byte blocks with SSE2 compare + movemask + popcount when
+ * available.
+ *
  * @param seq1 First sequence
  * @param seq2 Second sequence
  * @return Number of positions where bases differ
@@ -191,6 +307,15 @@ struct Alignment {
 /**
  * @brief Banded Smith-Waterman for faster alignment of similar sequences
  *
+ * The DP is restricted to diagonals j - i within bandwidth of the
+ * corridor spanned by the length difference (so a short read anywhere
+ * inside a longer window stays reachable), stored in a flat
+ * (m+1) x (|n-m| + 2*bandwidth + 1) band with the traceback run inside
+ * the band — O(m * (bandwidth + |n-m|)) time and memory instead of
+ * O(mn). Alignments whose true optimum leaves the band score lower
+ * than the full DP; use the adaptive variant when the required band is
+ * not known up front.
+ *
  * @param seq1 First sequence
  * @param seq2 Second sequence
  * @param bandwidth Maximum distance from diagonal to consider
@@ -205,19 +330,222 @@ struct Alignment {
 );
 
 /**
- * @brief Multiple sequence alignment (progressive)
+ * @brief Banded Smith-Waterman with affine gap scoring (Gotoh)
+ *
+ * Same band layout as bandedSmithWaterman(), but gaps cost
+ * gap_open_penalty to open and gap_extend_penalty per further base,
+ * which is what keeps long-read indels in one run instead of many
+ * single-base gaps.
+ */
+[[nodiscard]] Alignment bandedSmithWatermanAffine(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    size_t bandwidth,
+    const ScoringMatrix& scoring = ScoringMatrix{}
+);
+
+/**
+ * @brief Banded Smith-Waterman with automatic band growth
+ *
+ * Runs the banded DP and, whenever the optimal path touches the band
+ * edge (meaning a wider band might score higher), restarts with twice
+ * the bandwidth until the path fits or the band covers the whole
+ * matrix. Similar sequences finish at the initial width; diverged
+ * pairs pay only as much band as they need.
+ *
+ * @param initial_bandwidth Starting band half-width
+ */
+[[nodiscard]] Alignment adaptiveBandedSmithWaterman(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    size_t initial_bandwidth = 64,
+    const ScoringMatrix& scoring = ScoringMatrix{}
+);
+
+/// Adaptive banded alignment with affine gap scoring
+[[nodiscard]] Alignment adaptiveBandedSmithWatermanAffine(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    size_t initial_bandwidth = 64,
+    const ScoringMatrix& scoring = ScoringMatrix{}
+);
+
+/**
+ * @brief Multiple sequence alignment (guide-tree progressive)
  *
- * Aligns multiple sequences using a simple progressive approach.
+ * Builds a k-mer Jaccard distance matrix over the inputs, clusters it
+ * into a UPGMA guide tree, and merges alignment profiles up the tree
+ * with profile-profile global DP, so closely related sequences are
+ * joined first and each input is aligned exactly once. Independent
+ * subtree merges run on separate worker threads.
  *
  * @param sequences Vector of sequences to align
  * @param scoring Scoring parameters
- * @return Vector of aligned sequences (with gaps)
+ * @param num_threads Worker count (0 = hardware concurrency)
+ * @return Vector of aligned rows (with gaps), in input order
  */
 [[nodiscard]] std::vector<std::string> multipleAlignment(
     const std::vector<Sequence>& sequences,
-    const ScoringMatrix& scoring = ScoringMatrix{}
+    const ScoringMatrix& scoring = ScoringMatrix{},
+    size_t num_threads = 0
 );
 
+/**
+ * @brief Reusable alignment engine with arena-backed DP matrices
+ *
+ * Owns flat, contiguous score and traceback buffers (the layout
+ * AlignmentMatrix demonstrates) that grow to the largest problem seen
+ * and are reused across calls, so batch alignment does zero
+ * steady-state allocations for the DP fill. The free functions
+ * (smithWaterman, needlemanWunsch, semiGlobalAlignment) delegate to a
+ * thread-local Aligner, so existing callers get the reuse for free;
+ * hold a dedicated Aligner per worker when managing threads manually.
+ */
+class Aligner {
+public:
+    explicit Aligner(ScoringMatrix scoring = ScoringMatrix{})
+        : scoring_(scoring) {}
+
+    [[nodiscard]] Alignment smithWaterman(const Sequence& seq1,
+                                          const Sequence& seq2);
+    [[nodiscard]] Alignment needlemanWunsch(const Sequence& seq1,
+                                            const Sequence& seq2);
+    [[nodiscard]] Alignment semiGlobalAlignment(const Sequence& seq1,
+                                                const Sequence& seq2);
+
+    // Affine-gap (Gotoh) variants of the local and global DP
+    [[nodiscard]] Alignment smithWatermanAffine(const Sequence& seq1,
+                                                const Sequence& seq2);
+    [[nodiscard]] Alignment needlemanWunschAffine(const Sequence& seq1,
+                                                  const Sequence& seq2);
+
+    // Banded local DP in a flat (m+1) x (|n-m| + 2*bandwidth + 1)
+    // arena, with the traceback run inside the band
+    [[nodiscard]] Alignment bandedSmithWaterman(const Sequence& seq1,
+                                                const Sequence& seq2,
+                                                size_t bandwidth);
+    [[nodiscard]] Alignment bandedSmithWatermanAffine(const Sequence& seq1,
+                                                      const Sequence& seq2,
+                                                      size_t bandwidth);
+
+    // Restart with a doubled band while the optimal path touches the
+    // band edge
+    [[nodiscard]] Alignment adaptiveBandedSmithWaterman(
+        const Sequence& seq1, const Sequence& seq2,
+        size_t initial_bandwidth = 64);
+    [[nodiscard]] Alignment adaptiveBandedSmithWatermanAffine(
+        const Sequence& seq1, const Sequence& seq2,
+        size_t initial_bandwidth = 64);
+
+    [[nodiscard]] const ScoringMatrix& scoring() const noexcept { return scoring_; }
+    void setScoring(const ScoringMatrix& scoring) noexcept { scoring_ = scoring; }
+
+    /// Bytes currently held by the reusable DP buffers
+    [[nodiscard]] size_t arenaBytes() const noexcept {
+        return score_.capacity() * sizeof(int) +
+               trace_.capacity() * sizeof(TraceDirection) +
+               (up_score_.capacity() + left_score_.capacity()) * sizeof(int) +
+               (up_extend_.capacity() + left_extend_.capacity()) * sizeof(uint8_t);
+    }
+
+private:
+    ScoringMatrix scoring_;
+    std::vector<int> score_;             // (m+1) x (n+1), row-major
+    std::vector<TraceDirection> trace_;  // same shape as score_
+    size_t cols_ = 0;
+
+    // Gotoh gap matrices, only grown by the affine variants: up_* is a
+    // gap in seq2 (vertical move), left_* is a gap in seq1
+    std::vector<int> up_score_;
+    std::vector<int> left_score_;
+    std::vector<uint8_t> up_extend_;     // 1 = gap extended, 0 = gap opened
+    std::vector<uint8_t> left_extend_;
+
+    // Grows the buffers if needed; never shrinks, so steady-state
+    // batches reuse one allocation
+    void reserveMatrix(size_t rows, size_t cols);
+    void reserveAffineMatrix(size_t rows, size_t cols);
+
+    [[nodiscard]] int& scoreAt(size_t i, size_t j) noexcept {
+        return score_[i * cols_ + j];
+    }
+    [[nodiscard]] TraceDirection& traceAt(size_t i, size_t j) noexcept {
+        return trace_[i * cols_ + j];
+    }
+    [[nodiscard]] int& upAt(size_t i, size_t j) noexcept {
+        return up_score_[i * cols_ + j];
+    }
+    [[nodiscard]] int& leftAt(size_t i, size_t j) noexcept {
+        return left_score_[i * cols_ + j];
+    }
+
+    [[nodiscard]] Alignment tracebackFrom(std::string_view s1,
+                                          std::string_view s2,
+                                          size_t i, size_t j,
+                                          bool local) const;
+    [[nodiscard]] Alignment affineTracebackFrom(std::string_view s1,
+                                                std::string_view s2,
+                                                size_t i, size_t j,
+                                                bool local) const;
+
+    // Banded traceback in band coordinates (column = j - i + bandwidth);
+    // sets band_edge_hit_ when the path touches the band boundary, which
+    // is the adaptive variants' signal to double the band and retry
+    [[nodiscard]] Alignment bandedTracebackFrom(std::string_view s1,
+                                                std::string_view s2,
+                                                size_t i, size_t band_j,
+                                                std::ptrdiff_t diag_lo,
+                                                bool affine);
+    bool band_edge_hit_ = false;
+};
+
+/**
+ * @brief Which pairwise algorithm a batch alignment runs
+ */
+enum class AlignmentMode {
+    Local,       // smithWaterman
+    Global,      // needlemanWunsch
+    SemiGlobal   // semiGlobalAlignment
+};
+
+/**
+ * @brief Aligns batches of sequence pairs across worker threads
+ *
+ * Fans a span of pairs out over a pool of workers, each owning a
+ * private Aligner so DP arenas are reused without sharing. Pairs are
+ * dealt into per-worker deques and idle workers steal from the back of
+ * a victim's deque, so a few huge alignments cannot starve cores the
+ * way static partitioning would. Results come back in input order.
+ */
+class BatchAligner {
+public:
+    /**
+     * @brief Construct a batch aligner
+     * @param scoring Scoring parameters shared by all workers
+     * @param num_threads Worker count (0 = hardware concurrency)
+     */
+    explicit BatchAligner(ScoringMatrix scoring = ScoringMatrix{},
+                          size_t num_threads = 0);
+
+    /**
+     * @brief Align every pair, in parallel
+     * @param pairs Sequence pairs (first vs second)
+     * @param mode Pairwise algorithm to run
+     * @return One Alignment per pair, in input order
+     */
+    [[nodiscard]] std::vector<Alignment> alignAll(
+        std::span<const std::pair<Sequence, Sequence>> pairs,
+        AlignmentMode mode = AlignmentMode::Local) const;
+
+    [[nodiscard]] const ScoringMatrix& scoring() const noexcept { return scoring_; }
+    void setScoring(const ScoringMatrix& scoring) noexcept { scoring_ = scoring; }
+    [[nodiscard]] size_t threadCount() const noexcept { return num_threads_; }
+
+private:
+    ScoringMatrix scoring_;
+    size_t num_threads_;
+};
+
 /**
  * @brief Alignment matrix for detailed analysis
  */
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace bioflow {
+
+/**
+ * @brief Blocking bounded queue connecting pipeline stages
+ *
+ * Producers block in push() while the queue is at capacity, consumers
+ * block in pop() while it is empty; the bound is what lets a fast
+ * producer run ahead of its consumers without buffering unbounded
+ * data. close() wakes everyone: pending items are still drained, then
+ * pop() returns nullopt and push() returns false.
+ */
+template<typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity)
+        : capacity_(capacity > 0 ? capacity : 1) {}
+
+    /**
+     * @brief Block until there is room, then enqueue
+     * @return false if the queue was closed (item is dropped)
+     */
+    bool push(T item) {
+        std::unique_lock lock(mutex_);
+        not_full_.wait(lock, [this] {
+            return items_.size() < capacity_ || closed_;
+        });
+        if (closed_) return false;
+
+        items_.push_back(std::move(item));
+        lock.unlock();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Block until an item arrives or the queue closes
+     * @return The item, or nullopt once closed and drained
+     */
+    [[nodiscard]] std::optional<T> pop() {
+        std::unique_lock lock(mutex_);
+        not_empty_.wait(lock, [this] {
+            return !items_.empty() || closed_;
+        });
+        if (items_.empty()) return std::nullopt;
+
+        T item = std::move(items_.front());
+        items_.pop_front();
+        lock.unlock();
+        not_full_.notify_one();
+        return item;
+    }
+
+    /// Wake all waiters; pending items remain poppable
+    void close() {
+        {
+            std::lock_guard lock(mutex_);
+            closed_ = true;
+        }
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+private:
+    const size_t capacity_;
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    std::deque<T> items_;
+    bool closed_ = false;
+};
+
+} // namespace bioflow
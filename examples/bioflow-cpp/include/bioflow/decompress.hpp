@@ -0,0 +1,232 @@
+#pragma once
+
+#include "bioflow/bounded_queue.hpp"
+#include "bioflow/io.hpp"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace bioflow {
+
+// ============================================================================
+// Codec Interface
+// ============================================================================
+
+/**
+ * @brief Streaming decompression codec
+ *
+ * Pluggable interface for compressed-input support: gzip today, other
+ * codecs (e.g. zstd) slot in behind makeDecompressor() without touching
+ * the readers. Implementations keep stream state across calls, so
+ * arbitrarily large inputs decompress through a fixed-size output
+ * window.
+ */
+class Decompressor {
+public:
+    virtual ~Decompressor() = default;
+
+    struct Result {
+        size_t consumed;  // input bytes eaten this call
+        size_t produced;  // output bytes written this call
+        bool finished;    // logical end of the compressed stream
+    };
+
+    /**
+     * @brief Decompress as much input as fits in the output window
+     * @throws IOError on corrupt input
+     */
+    [[nodiscard]] virtual Result decompress(std::string_view input,
+                                            std::span<char> output) = 0;
+};
+
+/**
+ * @brief zlib-backed gzip/zlib stream decompressor
+ *
+ * Handles multi-member inputs (concatenated gzip streams, as produced
+ * by parallel compressors) by resetting at member boundaries and
+ * continuing; finished is only reported once every member has ended.
+ */
+class GzipDecompressor final : public Decompressor {
+public:
+    GzipDecompressor();
+    ~GzipDecompressor() override;
+
+    GzipDecompressor(const GzipDecompressor&) = delete;
+    GzipDecompressor& operator=(const GzipDecompressor&) = delete;
+
+    [[nodiscard]] Result decompress(std::string_view input,
+                                    std::span<char> output) override;
+
+private:
+    struct State;  // keeps zlib.h out of the public headers
+    std::unique_ptr<State> state_;
+};
+
+/// True if the buffer starts with a gzip member
+[[nodiscard]] bool isGzip(std::string_view data) noexcept;
+
+/// True if the buffer starts with a BGZF block (gzip + BC extra field)
+[[nodiscard]] bool isBgzf(std::string_view data) noexcept;
+
+/**
+ * @brief Build the codec for a compressed buffer, detected by magic
+ * @throws IOError if the format is not recognized
+ */
+[[nodiscard]] std::unique_ptr<Decompressor> makeDecompressor(
+    std::string_view data);
+
+// ============================================================================
+// Whole-Buffer Helpers
+// ============================================================================
+
+/**
+ * @brief Compress a buffer into a single gzip member
+ */
+[[nodiscard]] std::string compressGzip(std::string_view data, int level = 6);
+
+/**
+ * @brief Compress a buffer into BGZF blocks (plus the EOF marker)
+ *
+ * Each block is an independent gzip member with its compressed size
+ * recorded in the BC extra field, which is what makes parallel
+ * decompression possible.
+ */
+[[nodiscard]] std::string compressBgzf(std::string_view data,
+                                       size_t block_size = 1 << 16,
+                                       int level = 6);
+
+/**
+ * @brief Decompress a BGZF buffer with one thread per group of blocks
+ *
+ * Block boundaries and output sizes are read from the BGZF headers, so
+ * every block inflates independently into its precomputed slice of the
+ * output.
+ *
+ * @param num_threads Worker count (0 = hardware concurrency)
+ * @throws IOError on corrupt or non-BGZF input
+ */
+[[nodiscard]] std::string decompressBgzfParallel(std::string_view data,
+                                                 size_t num_threads = 0);
+
+// ============================================================================
+// Streaming Readers
+// ============================================================================
+
+/**
+ * @brief Double-buffered streaming decompression over a mapped file
+ *
+ * A background thread decompresses ahead into a two-slot bounded
+ * queue while the caller consumes the previous chunk, so
+ * decompression overlaps parsing instead of serializing with it (the
+ * same work a zcat pipe does, minus the extra copy through the pipe
+ * buffer). BGZF inputs decompress their blocks in parallel; plain
+ * gzip streams through GzipDecompressor; uncompressed data passes
+ * through untouched, so callers need not special-case their inputs.
+ */
+class DecompressingReader {
+public:
+    /**
+     * @brief Open and map a (possibly compressed) file
+     * @throws IOError if the file cannot be mapped
+     */
+    explicit DecompressingReader(const std::string& path,
+                                 size_t chunk_size = size_t{1} << 20);
+
+    /**
+     * @brief Stream from an in-memory buffer (not owned by the reader)
+     */
+    explicit DecompressingReader(std::string_view buffer,
+                                 size_t chunk_size = size_t{1} << 20);
+
+    ~DecompressingReader();
+
+    DecompressingReader(const DecompressingReader&) = delete;
+    DecompressingReader& operator=(const DecompressingReader&) = delete;
+
+    /**
+     * @brief Block for the next decompressed chunk
+     * @return false at end of stream
+     * @throws IOError if decompression failed
+     */
+    [[nodiscard]] bool nextChunk(std::string& chunk);
+
+    /// Drain the remaining stream into one buffer
+    [[nodiscard]] std::string readAll();
+
+private:
+    std::optional<MappedFile> file_;
+    std::string_view data_;
+    size_t chunk_size_;
+
+    BoundedQueue<std::string> chunks_{2};  // double buffer
+    std::thread producer_;
+    std::exception_ptr error_;
+
+    void start();
+    void produceStream();
+    void produceBgzf();
+    void producePassthrough();
+};
+
+/**
+ * @brief FASTQ reader over compressed input
+ *
+ * Frames complete records out of the decompressed chunk stream (a
+ * record is exactly four lines) and parses them with FastqReader, so
+ * gzip/BGZF FASTQ feeds the same parser as plain files:
+ * @code
+ * CompressedFastqReader reader("reads.fastq.gz");
+ * while (auto record = reader.next()) {
+ *     process(*record);
+ * }
+ * @endcode
+ */
+class CompressedFastqReader {
+public:
+    /**
+     * @brief Open and map a compressed (or plain) FASTQ file
+     * @throws IOError if the file cannot be mapped
+     */
+    explicit CompressedFastqReader(
+        const std::string& path,
+        QualityEncoding encoding = QualityEncoding::Phred33);
+
+    /**
+     * @brief Stream from an in-memory buffer (not owned by the reader)
+     */
+    explicit CompressedFastqReader(
+        std::string_view buffer,
+        QualityEncoding encoding = QualityEncoding::Phred33);
+
+    /**
+     * @brief Advance to the next record
+     * @return The record, or nullopt at end of input
+     * @throws IOError on malformed or truncated records
+     */
+    [[nodiscard]] std::optional<QualifiedSequence> next();
+
+    /// Read every remaining record
+    [[nodiscard]] std::vector<QualifiedSequence> readAll();
+
+private:
+    DecompressingReader reader_;
+    QualityEncoding encoding_;
+
+    std::string window_;     // decompressed data not yet parsed
+    size_t scanned_ = 0;     // window_ prefix already newline-counted
+    size_t newlines_ = 0;    // newlines seen in the scanned prefix
+    size_t complete_ = 0;    // window_ prefix ending on a record boundary
+    bool input_done_ = false;
+
+    std::vector<QualifiedSequence> pending_;
+    size_t pending_pos_ = 0;
+
+    [[nodiscard]] bool refill();
+};
+
+} // namespace bioflow
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#if defined(BIOFLOW_INSTRUMENT)
+#include <atomic>
+#endif
+
+namespace bioflow::instrument {
+
+/**
+ * @brief Snapshot of the library-wide performance counters
+ *
+ * Values are cumulative since process start (or the last reset()) and
+ * cover every thread. When instrumentation is compiled out the
+ * snapshot is always zero; check enabled() before interpreting one.
+ */
+struct Report {
+    uint64_t bases_parsed = 0;           ///< FASTA/FASTQ bases parsed
+    uint64_t kmers_inserted = 0;         ///< k-mer table insertions
+    uint64_t dp_cells_filled = 0;        ///< alignment DP cells reserved
+    uint64_t bytes_decompressed = 0;     ///< inflated output bytes
+    uint64_t arena_bytes_allocated = 0;  ///< string-arena block capacity
+};
+
+/// Whether counters were compiled in (BIOFLOW_ENABLE_INSTRUMENTATION)
+[[nodiscard]] bool enabled() noexcept;
+
+/// Read the current counter values
+[[nodiscard]] Report snapshot() noexcept;
+
+/// Zero all counters (e.g. between pipeline runs)
+void reset() noexcept;
+
+/**
+ * @brief Render a report as aligned "name value" lines
+ *
+ * One counter per line, suitable for logs and for diffing two runs.
+ */
+[[nodiscard]] std::string formatReport(const Report& report);
+
+#if defined(BIOFLOW_INSTRUMENT)
+
+namespace detail {
+
+struct Counters {
+    std::atomic<uint64_t> bases_parsed{0};
+    std::atomic<uint64_t> kmers_inserted{0};
+    std::atomic<uint64_t> dp_cells_filled{0};
+    std::atomic<uint64_t> bytes_decompressed{0};
+    std::atomic<uint64_t> arena_bytes_allocated{0};
+};
+
+Counters& counters() noexcept;
+
+} // namespace detail
+
+#endif
+
+} // namespace bioflow::instrument
+
+/**
+ * @brief Bump a performance counter on a hot path
+ *
+ * Relaxed atomic add when instrumentation is compiled in; expands to
+ * nothing otherwise, so normal builds carry no cost. Prefer one call
+ * per batch (record, scan, matrix fill) over one call per element.
+ */
+#if defined(BIOFLOW_INSTRUMENT)
+#define BIOFLOW_COUNT(counter, amount)                            \
+    ::bioflow::instrument::detail::counters().counter.fetch_add(  \
+        static_cast<uint64_t>(amount), std::memory_order_relaxed)
+#else
+#define BIOFLOW_COUNT(counter, amount) ((void)0)
+#endif
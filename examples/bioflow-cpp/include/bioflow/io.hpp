@@ -0,0 +1,205 @@
+#pragma once
+
+#include "bioflow/sequence.hpp"
+#include "bioflow/quality.hpp"
+#include "bioflow/string_arena.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+#include <optional>
+
+namespace bioflow {
+
+/**
+ * @brief Exception class for I/O-related errors
+ */
+class IOError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief Read-only memory-mapped file
+ *
+ * Maps the whole file with MAP_PRIVATE and advises the kernel of
+ * sequential access, so multi-gigabyte inputs stream through the page
+ * cache without ever being copied into userspace buffers. The mapping
+ * is released on destruction; the class is move-only.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Map a file into memory
+     * @param path Path to the file
+     * @throws IOError if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    [[nodiscard]] const char* data() const noexcept { return data_; }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /// The whole mapping as a string_view
+    [[nodiscard]] std::string_view view() const noexcept {
+        return {data_, size_};
+    }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/**
+ * @brief Find the next newline in a buffer
+ *
+ * Vectorized scan (AVX2/SSE2 where available) used by the readers to
+ * locate record boundaries.
+ *
+ * @param text Buffer to scan
+ * @param from Offset to start scanning at
+ * @return Offset of the next '\n' at or after from, or text.length()
+ */
+[[nodiscard]] size_t findNewline(std::string_view text, size_t from = 0) noexcept;
+
+/**
+ * @brief A single FASTA record backed by views into the input buffer
+ *
+ * The views stay valid as long as the reader (and its mapping) lives.
+ * raw_bases spans the sequence lines including any internal newlines;
+ * bases() materializes the newline-free sequence, which is the one
+ * copy a record costs when the input wraps lines.
+ */
+struct FastaRecord {
+    std::string_view id;
+    std::string_view description;  // Header text after the first space
+    std::string_view raw_bases;    // May contain newlines for wrapped input
+
+    /// Sequence bases with line breaks stripped
+    [[nodiscard]] std::string bases() const;
+
+    /// Convert to a validated Sequence
+    [[nodiscard]] Sequence toSequence() const;
+};
+
+/**
+ * @brief A single FASTQ record backed by views into the input buffer
+ *
+ * FASTQ bases and quality each occupy exactly one line, so every field
+ * is a zero-copy view into the mapped file.
+ */
+struct FastqRecord {
+    std::string_view id;
+    std::string_view description;
+    std::string_view bases;
+    std::string_view quality;
+
+    /// Convert to an owning QualifiedSequence
+    [[nodiscard]] QualifiedSequence toQualifiedSequence(
+        QualityEncoding encoding = QualityEncoding::Phred33) const;
+
+    /**
+     * @brief Convert with the ID and description interned into an arena
+     *
+     * The record's bases and quality are still copied (they must
+     * outlive the input buffer), but the ID fields become views into
+     * the arena — no per-record ID allocations on the streaming path.
+     */
+    [[nodiscard]] QualifiedSequence toQualifiedSequence(
+        QualityEncoding encoding, StringArena& ids) const;
+};
+
+/**
+ * @brief Streaming FASTA reader over a memory-mapped file
+ *
+ * Yields string_view-backed records without copying the underlying
+ * data. Typical use:
+ * @code
+ * FastaReader reader("genome.fa");
+ * FastaRecord record;
+ * while (reader.next(record)) {
+ *     process(record.id, record.bases());
+ * }
+ * @endcode
+ */
+class FastaReader {
+public:
+    /**
+     * @brief Open and map a FASTA file
+     * @throws IOError if the file cannot be mapped
+     */
+    explicit FastaReader(const std::string& path);
+
+    /**
+     * @brief Parse from an in-memory buffer (not owned by the reader)
+     */
+    explicit FastaReader(std::string_view buffer);
+
+    /**
+     * @brief Advance to the next record
+     * @param record Filled with views into the input on success
+     * @return false at end of input
+     * @throws IOError on malformed input
+     */
+    [[nodiscard]] bool next(FastaRecord& record);
+
+    /// Restart from the beginning of the input
+    void reset() noexcept { pos_ = 0; }
+
+    /// Read every remaining record as a validated Sequence
+    [[nodiscard]] std::vector<Sequence> readAll();
+
+private:
+    std::optional<MappedFile> file_;  // Unset when reading a caller buffer
+    std::string_view buffer_;
+    size_t pos_ = 0;
+};
+
+/**
+ * @brief Streaming FASTQ reader over a memory-mapped file
+ *
+ * Same shape as FastaReader; each record is four lines and every field
+ * of the yielded FastqRecord is a zero-copy view.
+ */
+class FastqReader {
+public:
+    /**
+     * @brief Open and map a FASTQ file
+     * @throws IOError if the file cannot be mapped
+     */
+    explicit FastqReader(const std::string& path);
+
+    /**
+     * @brief Parse from an in-memory buffer (not owned by the reader)
+     */
+    explicit FastqReader(std::string_view buffer);
+
+    /**
+     * @brief Advance to the next record
+     * @param record Filled with views into the input on success
+     * @return false at end of input
+     * @throws IOError on malformed or truncated records
+     */
+    [[nodiscard]] bool next(FastqRecord& record);
+
+    /// Restart from the beginning of the input
+    void reset() noexcept { pos_ = 0; }
+
+    /// Read every remaining record as an owning QualifiedSequence
+    [[nodiscard]] std::vector<QualifiedSequence> readAll(
+        QualityEncoding encoding = QualityEncoding::Phred33);
+
+private:
+    std::optional<MappedFile> file_;
+    std::string_view buffer_;
+    size_t pos_ = 0;
+};
+
+} // namespace bioflow
@@ -1,8 +1,16 @@
 #pragma once
 
 #include "bioflow/sequence.hpp"
+#include "bioflow/io.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <filesystem>
+#include <optional>
 #include <unordered_map>
 #include <vector>
+#include <type_traits>
 #include <utility>
 #include <span>
 #include <ranges>
@@ -98,6 +106,18 @@ public:
      */
     void countRaw(std::string_view bases);
 
+    /**
+     * @brief Write the table to disk in the binary profile format
+     * @throws KMerError if the file cannot be written
+     */
+    void save(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Load a table previously written by save()
+     * @throws KMerError if the file is missing, truncated or malformed
+     */
+    [[nodiscard]] static KMerCounter load(const std::filesystem::path& path);
+
     /**
      * @brief Get count for a specific k-mer
      * @param kmer The k-mer to look up
@@ -171,6 +191,529 @@ private:
     [[nodiscard]] static bool hasAmbiguous(std::string_view kmer) noexcept;
 };
 
+// ============================================================================
+// Integer-Encoded K-mer Counting
+// ============================================================================
+
+/**
+ * @brief Encode a k-mer (k <= 32) as a 2-bit-packed uint64_t
+ * @param kmer The k-mer string (must contain only A/C/G/T)
+ * @return The packed code, first base in the highest-order pair
+ * @throws KMerError if the k-mer is longer than 32 bases
+ */
+[[nodiscard]] uint64_t encodeKmer(std::string_view kmer);
+
+/**
+ * @brief Decode a 2-bit-packed k-mer code back to a string
+ */
+[[nodiscard]] std::string decodeKmer(uint64_t code, size_t k);
+
+/**
+ * @brief Mix an encoded k-mer code into a well-distributed hash
+ *
+ * splitmix64 finalizer: encoded k-mers differ in low bits only for
+ * similar sequences, so mix thoroughly before masking to a table size.
+ */
+[[nodiscard]] inline uint64_t hashKmerCode(uint64_t code) noexcept {
+    uint64_t h = code;
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+/**
+ * @brief Invoke fn with the 2-bit-packed code of every N-free window
+ *
+ * Maintains the code incrementally (two bit operations per position);
+ * windows containing N restart the rolling code. This is the shared scan
+ * loop behind the encoded counters.
+ */
+template<typename F>
+    requires std::invocable<F, uint64_t>
+void forEachKmerCode(std::string_view bases, size_t k, F&& fn) {
+    if (bases.length() < k) return;
+
+    const uint64_t mask = k == 32 ? ~uint64_t{0} : (uint64_t{1} << (2 * k)) - 1;
+    uint64_t code = 0;
+    size_t valid = 0;  // consecutive non-N bases ending at current position
+
+    for (char c : bases) {
+        if (c == 'N') {
+            valid = 0;
+            continue;
+        }
+
+        uint64_t b = (c == 'A') ? 0 : (c == 'C') ? 1 : (c == 'G') ? 2 : 3;
+        code = ((code << 2) | b) & mask;
+        if (++valid >= k) {
+            fn(code);
+        }
+    }
+}
+
+/**
+ * @brief forEachKmerCode with the k-mer length fixed at compile time
+ *
+ * Same scan, but the mask and window test are constexpr, so the
+ * compiler can unroll the rolling update instead of carrying
+ * variable-length logic through the inner loop.
+ */
+template<size_t K, typename F>
+    requires std::invocable<F, uint64_t>
+void forEachKmerCode(std::string_view bases, F&& fn) {
+    static_assert(K >= 1 && K <= 32, "K must be between 1 and 32");
+    if (bases.length() < K) return;
+
+    constexpr uint64_t mask =
+        K == 32 ? ~uint64_t{0} : (uint64_t{1} << (2 * K)) - 1;
+    uint64_t code = 0;
+    size_t valid = 0;
+
+    for (char c : bases) {
+        if (c == 'N') {
+            valid = 0;
+            continue;
+        }
+
+        uint64_t b = (c == 'A') ? 0 : (c == 'C') ? 1 : (c == 'G') ? 2 : 3;
+        code = ((code << 2) | b) & mask;
+        if (++valid >= K) {
+            fn(code);
+        }
+    }
+}
+
+/**
+ * @brief Invoke fn with the canonical code of every N-free window
+ *
+ * Maintains forward and reverse-complement codes incrementally as the
+ * window slides; the canonical form is min(fwd, rc), which matches the
+ * lexicographic rule of canonicalKmer() because the 2-bit encoding is
+ * order-preserving. No reverse-complement string is ever built.
+ */
+template<typename F>
+    requires std::invocable<F, uint64_t>
+void forEachCanonicalKmerCode(std::string_view bases, size_t k, F&& fn) {
+    if (bases.length() < k) return;
+
+    const uint64_t mask = k == 32 ? ~uint64_t{0} : (uint64_t{1} << (2 * k)) - 1;
+    const size_t rc_shift = 2 * (k - 1);
+    uint64_t fwd = 0;
+    uint64_t rc = 0;
+    size_t valid = 0;
+
+    for (char c : bases) {
+        if (c == 'N') {
+            valid = 0;
+            continue;
+        }
+
+        uint64_t b = (c == 'A') ? 0 : (c == 'C') ? 1 : (c == 'G') ? 2 : 3;
+        fwd = ((fwd << 2) | b) & mask;
+        // The newest base becomes the highest pair of the reverse
+        // complement, complemented
+        rc = (rc >> 2) | ((b ^ 3) << rc_shift);
+        if (++valid >= k) {
+            fn(std::min(fwd, rc));
+        }
+    }
+}
+
+/**
+ * @brief forEachCanonicalKmerCode with the k-mer length fixed at
+ *        compile time (see the fixed-K forEachKmerCode)
+ */
+template<size_t K, typename F>
+    requires std::invocable<F, uint64_t>
+void forEachCanonicalKmerCode(std::string_view bases, F&& fn) {
+    static_assert(K >= 1 && K <= 32, "K must be between 1 and 32");
+    if (bases.length() < K) return;
+
+    constexpr uint64_t mask =
+        K == 32 ? ~uint64_t{0} : (uint64_t{1} << (2 * K)) - 1;
+    constexpr size_t rc_shift = 2 * (K - 1);
+    uint64_t fwd = 0;
+    uint64_t rc = 0;
+    size_t valid = 0;
+
+    for (char c : bases) {
+        if (c == 'N') {
+            valid = 0;
+            continue;
+        }
+
+        uint64_t b = (c == 'A') ? 0 : (c == 'C') ? 1 : (c == 'G') ? 2 : 3;
+        fwd = ((fwd << 2) | b) & mask;
+        rc = (rc >> 2) | ((b ^ 3) << rc_shift);
+        if (++valid >= K) {
+            fn(std::min(fwd, rc));
+        }
+    }
+}
+
+/**
+ * @brief Invoke fn with k as a compile-time constant for common k
+ *
+ * Maps the handful of k values production jobs actually use onto the
+ * fixed-K scan loops; fn receives a std::integral_constant<size_t, K>
+ * it can pass as a template argument.
+ *
+ * @return true if k was dispatched, false if the caller must fall
+ *         back to the runtime-k path
+ */
+template<typename F>
+bool withFixedKmerLength(size_t k, F&& fn) {
+    switch (k) {
+        case 15: fn(std::integral_constant<size_t, 15>{}); return true;
+        case 21: fn(std::integral_constant<size_t, 21>{}); return true;
+        case 25: fn(std::integral_constant<size_t, 25>{}); return true;
+        case 31: fn(std::integral_constant<size_t, 31>{}); return true;
+        default: return false;
+    }
+}
+
+/**
+ * @brief K-mer counter keyed by 2-bit-packed integer codes (k <= 32)
+ *
+ * Allocation-free counting loop: the current window's code is maintained
+ * incrementally as the window slides (two bit operations per position,
+ * no per-window std::string), and counts live in a flat open-addressing
+ * hash table with linear probing instead of a node-based map. Windows
+ * containing N restart the rolling code rather than probing the table.
+ *
+ * Query results are decoded back to strings, so the API matches
+ * KMerCounter where it overlaps.
+ */
+class EncodedKMerCounter {
+public:
+    /**
+     * @brief Construct a counter for k-mers of length k
+     * @throws KMerError if k is 0 or greater than 32
+     */
+    explicit EncodedKMerCounter(size_t k);
+
+    void count(const Sequence& seq);
+    void countRaw(std::string_view bases);
+
+    /**
+     * @brief Count all k-mers from multiple sequences
+     */
+    template<std::ranges::range R>
+        requires std::same_as<std::ranges::range_value_t<R>, Sequence>
+    void countAll(R&& sequences) {
+        for (const auto& seq : sequences) {
+            count(seq);
+        }
+    }
+
+    // Queries (same semantics as KMerCounter)
+    [[nodiscard]] size_t getCount(std::string_view kmer) const;
+    [[nodiscard]] size_t getCount(uint64_t code) const noexcept;
+    [[nodiscard]] bool contains(std::string_view kmer) const;
+    [[nodiscard]] std::vector<KMerEntry> mostFrequent(size_t n) const;
+    [[nodiscard]] std::vector<KMerEntry> aboveThreshold(size_t threshold) const;
+    [[nodiscard]] KMerSpectrum spectrum() const;
+    [[nodiscard]] std::vector<KMerEntry> allKmers() const;
+
+    // Accessors
+    [[nodiscard]] size_t uniqueCount() const noexcept { return size_; }
+    [[nodiscard]] size_t totalCount() const noexcept { return total_; }
+    [[nodiscard]] size_t k() const noexcept { return k_; }
+
+    /**
+     * @brief Write the table to disk in the binary profile format
+     * @throws KMerError if the file cannot be written
+     */
+    void save(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Load a table previously written by save()
+     * @throws KMerError if the file is missing, truncated or malformed
+     */
+    [[nodiscard]] static EncodedKMerCounter load(const std::filesystem::path& path);
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Visit every (code, count) pair without materializing entries
+     */
+    template<typename F>
+        requires std::invocable<F, uint64_t, size_t>
+    void forEach(F&& fn) const {
+        for (const auto& slot : slots_) {
+            if (slot.count != 0) {
+                fn(slot.key, slot.count);
+            }
+        }
+    }
+
+    void clear() noexcept;
+    void merge(const EncodedKMerCounter& other);
+
+    /**
+     * @brief Add occurrences of an encoded k-mer directly
+     */
+    void add(uint64_t code, size_t occurrences);
+
+private:
+    // count == 0 marks an empty slot, so any key value is usable
+    struct Slot {
+        uint64_t key;
+        size_t count;
+    };
+
+    size_t k_;
+    std::vector<Slot> slots_;
+    size_t size_ = 0;
+    size_t total_ = 0;
+
+    static constexpr size_t kInitialCapacity = 1024;  // power of two
+
+    [[nodiscard]] size_t findSlot(uint64_t code) const noexcept;
+    void insert(uint64_t code, size_t occurrences);
+    void grow();
+};
+
+/**
+ * @brief EncodedKMerCounter with the k-mer length fixed at compile time
+ *
+ * Storage and queries delegate to an EncodedKMerCounter; only the scan
+ * loop differs, using the fixed-K forEachKmerCode so the mask and
+ * window test are compile-time constants. Worth ~25% on the counting
+ * loop for the production k values. Use withFixedKmerLength() to pick
+ * an instantiation from a runtime k:
+ * @code
+ * EncodedKMerCounter counts(k);
+ * if (!withFixedKmerLength(k, [&](auto fixed_k) {
+ *         FixedKMerCounter<fixed_k()> counter;
+ *         counter.countRaw(bases);
+ *         counts.merge(counter.underlying());
+ *     })) {
+ *     counts.countRaw(bases);  // uncommon k: runtime loop
+ * }
+ * @endcode
+ */
+template<size_t K>
+class FixedKMerCounter {
+    static_assert(K >= 1 && K <= 32, "K must be between 1 and 32");
+
+public:
+    FixedKMerCounter() : counter_(K) {}
+
+    void count(const Sequence& seq) { countRaw(seq.bases()); }
+
+    void countRaw(std::string_view bases) {
+        forEachKmerCode<K>(bases, [this](uint64_t code) {
+            counter_.add(code, 1);
+        });
+    }
+
+    template<std::ranges::range R>
+        requires std::same_as<std::ranges::range_value_t<R>, Sequence>
+    void countAll(R&& sequences) {
+        for (const auto& seq : sequences) {
+            count(seq);
+        }
+    }
+
+    // Queries (same semantics as EncodedKMerCounter)
+    [[nodiscard]] size_t getCount(std::string_view kmer) const {
+        return counter_.getCount(kmer);
+    }
+    [[nodiscard]] size_t getCount(uint64_t code) const noexcept {
+        return counter_.getCount(code);
+    }
+    [[nodiscard]] bool contains(std::string_view kmer) const {
+        return counter_.contains(kmer);
+    }
+    [[nodiscard]] std::vector<KMerEntry> mostFrequent(size_t n) const {
+        return counter_.mostFrequent(n);
+    }
+    [[nodiscard]] KMerSpectrum spectrum() const { return counter_.spectrum(); }
+
+    // Accessors
+    [[nodiscard]] size_t uniqueCount() const noexcept { return counter_.uniqueCount(); }
+    [[nodiscard]] size_t totalCount() const noexcept { return counter_.totalCount(); }
+    [[nodiscard]] static constexpr size_t k() noexcept { return K; }
+    [[nodiscard]] bool empty() const noexcept { return counter_.empty(); }
+
+    template<typename F>
+        requires std::invocable<F, uint64_t, size_t>
+    void forEach(F&& fn) const {
+        counter_.forEach(std::forward<F>(fn));
+    }
+
+    void clear() noexcept { counter_.clear(); }
+
+    /// The runtime-typed counter, e.g. for merging across k dispatches
+    [[nodiscard]] const EncodedKMerCounter& underlying() const noexcept {
+        return counter_;
+    }
+
+private:
+    EncodedKMerCounter counter_;
+};
+
+/**
+ * @brief Multi-threaded k-mer counting over sequence collections
+ *
+ * Sequences are pulled off a shared atomic cursor by a pool of worker
+ * threads, each counting into its own set of shard-local
+ * EncodedKMerCounters. Shards are selected by the high bits of the
+ * k-mer hash, so the final merge assigns each shard index to one thread
+ * and runs with no contention at all. Queries route through the same
+ * shard function and carry KMerCounter's semantics.
+ */
+class ParallelKMerCounter {
+public:
+    /**
+     * @brief Construct a parallel counter
+     * @param k The k-mer length (1-32)
+     * @param num_threads Worker count; 0 means hardware concurrency
+     */
+    explicit ParallelKMerCounter(size_t k, size_t num_threads = 0);
+
+    /**
+     * @brief Count k-mers from all sequences across the thread pool
+     */
+    void countAll(std::span<const Sequence> sequences);
+    void countAll(const std::vector<Sequence>& sequences) {
+        countAll(std::span<const Sequence>(sequences));
+    }
+
+    // Queries (same semantics as KMerCounter)
+    [[nodiscard]] size_t getCount(std::string_view kmer) const;
+    [[nodiscard]] size_t getCount(uint64_t code) const noexcept;
+    [[nodiscard]] bool contains(std::string_view kmer) const;
+    [[nodiscard]] std::vector<KMerEntry> mostFrequent(size_t n) const;
+    [[nodiscard]] KMerSpectrum spectrum() const;
+    [[nodiscard]] std::vector<KMerEntry> allKmers() const;
+
+    // Accessors
+    [[nodiscard]] size_t uniqueCount() const noexcept;
+    [[nodiscard]] size_t totalCount() const noexcept;
+    [[nodiscard]] size_t k() const noexcept { return k_; }
+    [[nodiscard]] size_t threadCount() const noexcept { return num_threads_; }
+
+    void clear() noexcept;
+
+private:
+    size_t k_;
+    size_t num_threads_;
+    size_t num_shards_;  // power of two, >= num_threads_
+    std::vector<EncodedKMerCounter> shards_;
+
+    [[nodiscard]] size_t shardOf(uint64_t code) const noexcept {
+        // High bits pick the shard; the table index inside the shard
+        // uses the low bits of the same hash
+        return (hashKmerCode(code) >> 32) & (num_shards_ - 1);
+    }
+};
+
+/**
+ * @brief Lock-free concurrent k-mer table for shared-index querying
+ *
+ * Open-addressing table over encoded codes where slots are claimed
+ * with an atomic compare-exchange on the key and counts are relaxed
+ * atomic adds, so many reader threads can query one shared table while
+ * other threads keep inserting — no external mutex. Reads never retry
+ * or block: a probe run ends at the first empty slot, and claimed keys
+ * are immutable once published.
+ *
+ * The trade for lock freedom is a fixed capacity: the table cannot be
+ * rehashed while readers hold slot references, so size it from the
+ * expected number of distinct k-mers at construction. add() throws
+ * KMerError when the table runs out of room.
+ *
+ * Queries carry KMerCounter's semantics where they overlap. uniqueCount
+ * and totalCount are monotonic snapshots and may trail in-flight
+ * inserts by a moment.
+ */
+class ConcurrentKMerCounter {
+public:
+    /**
+     * @brief Construct a fixed-capacity concurrent counter
+     *
+     * Capacity is the next power of two holding expected_kmers at a
+     * ~0.7 load factor.
+     *
+     * @param k The k-mer length (1-31; 32 would collide with the empty
+     *          slot sentinel)
+     * @param expected_kmers Distinct k-mers the table must hold
+     * @throws KMerError if k is out of range
+     */
+    ConcurrentKMerCounter(size_t k, size_t expected_kmers);
+
+    ConcurrentKMerCounter(const ConcurrentKMerCounter&) = delete;
+    ConcurrentKMerCounter& operator=(const ConcurrentKMerCounter&) = delete;
+
+    // Thread-safe inserts
+    void count(const Sequence& seq);
+    void countRaw(std::string_view bases);
+
+    /**
+     * @brief Add occurrences of an encoded k-mer directly
+     * @throws KMerError if the table is full
+     */
+    void add(uint64_t code, size_t occurrences);
+
+    // Wait-free queries (same semantics as KMerCounter)
+    [[nodiscard]] size_t getCount(std::string_view kmer) const;
+    [[nodiscard]] size_t getCount(uint64_t code) const noexcept;
+    [[nodiscard]] bool contains(std::string_view kmer) const;
+
+    // Accessors
+    [[nodiscard]] size_t uniqueCount() const noexcept {
+        return size_.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] size_t totalCount() const noexcept {
+        return total_.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] size_t k() const noexcept { return k_; }
+    [[nodiscard]] size_t capacity() const noexcept { return num_slots_; }
+    [[nodiscard]] bool empty() const noexcept { return uniqueCount() == 0; }
+
+    /**
+     * @brief Visit every published (code, count) pair
+     *
+     * Safe to run concurrently with inserts; pairs claimed mid-scan may
+     * or may not be visited.
+     */
+    template<typename F>
+        requires std::invocable<F, uint64_t, size_t>
+    void forEach(F&& fn) const {
+        for (size_t i = 0; i < num_slots_; ++i) {
+            uint64_t key = slots_[i].key.load(std::memory_order_acquire);
+            if (key == kEmptySlot) continue;
+            size_t count = slots_[i].count.load(std::memory_order_relaxed);
+            if (count != 0) {
+                fn(key, count);
+            }
+        }
+    }
+
+private:
+    // A slot is claimed by CAS-ing the key from the sentinel; the count
+    // is bumped separately, so a freshly claimed slot can briefly read
+    // as count 0
+    struct Slot {
+        std::atomic<uint64_t> key{kEmptySlot};
+        std::atomic<size_t> count{0};
+    };
+
+    // Not a valid 2-bit code for k <= 31
+    static constexpr uint64_t kEmptySlot = ~uint64_t{0};
+
+    size_t k_;
+    size_t num_slots_;  // power of two
+    size_t max_size_;   // insert ceiling (~0.9 load)
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<size_t> size_{0};
+    std::atomic<size_t> total_{0};
+};
+
 /**
  * @brief Compute canonical k-mer (lexicographically smaller of k-mer and its reverse complement)
  * @param kmer The k-mer string
@@ -180,22 +723,339 @@ private:
 
 /**
  * @brief Count k-mers using canonical representation
+ *
+ * Strand-neutral counting on the encoded path: forward and
+ * reverse-complement codes are maintained incrementally as the window
+ * slides and min(fwd, rc) keys an EncodedKMerCounter, so no
+ * reverse-complement string (or any other per-window allocation) is
+ * built. Queries accept either strand and report the canonical count.
  */
 class CanonicalKMerCounter {
 public:
+    /**
+     * @brief Construct a counter for k-mers of length k
+     * @throws KMerError if k is 0 or greater than 32
+     */
     explicit CanonicalKMerCounter(size_t k);
 
     void count(const Sequence& seq);
     [[nodiscard]] size_t getCount(std::string_view kmer) const;
     [[nodiscard]] std::vector<KMerEntry> mostFrequent(size_t n) const;
-    [[nodiscard]] size_t uniqueCount() const noexcept { return counts_.size(); }
+    [[nodiscard]] size_t uniqueCount() const noexcept { return counter_.uniqueCount(); }
+    [[nodiscard]] size_t totalCount() const noexcept { return counter_.totalCount(); }
+    [[nodiscard]] size_t k() const noexcept { return counter_.k(); }
+
+    /**
+     * @brief Write the table to disk in the binary profile format
+     * @throws KMerError if the file cannot be written
+     */
+    void save(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Load a table previously written by save()
+     * @throws KMerError if the file is missing, truncated or malformed
+     */
+    [[nodiscard]] static CanonicalKMerCounter load(const std::filesystem::path& path);
+
+    /**
+     * @brief Visit every (canonical code, count) pair
+     */
+    template<typename F>
+    void forEach(F&& fn) const {
+        counter_.forEach(std::forward<F>(fn));
+    }
+
+private:
+    EncodedKMerCounter counter_;
+};
+
+/**
+ * @brief Frozen, sorted k-mer count profile for fast pairwise comparison
+ *
+ * Snapshots a counter into a flat array of (encoded k-mer, count) pairs
+ * sorted by code. The similarity measures in stats (Jaccard, cosine,
+ * Bray-Curtis) run as linear merge-joins over two profiles instead of
+ * per-key hash lookups, which is what all-vs-all comparison matrices
+ * spend their time on. The flat layout is also the on-disk format:
+ * save() streams the sorted array out once, and load() maps the file
+ * back in and points the profile at the payload without copying it, so
+ * a table counted by one pipeline stage is reused by the rest.
+ *
+ * Profiles are immutable: rebuild one after the source counter changes.
+ */
+class KMerProfile {
+public:
+    struct Entry {
+        uint64_t code;
+        size_t count;
+    };
+
+    /// Snapshot a string-keyed counter (keys are encoded, then sorted)
+    explicit KMerProfile(const KMerCounter& counter);
+
+    /// Snapshot an encoded counter
+    explicit KMerProfile(const EncodedKMerCounter& counter);
+
+    /// Snapshot a canonical counter (codes are canonical codes)
+    explicit KMerProfile(const CanonicalKMerCounter& counter);
+
+    [[nodiscard]] size_t k() const noexcept { return k_; }
+    [[nodiscard]] size_t uniqueCount() const noexcept { return entries_.size(); }
+    [[nodiscard]] size_t totalCount() const noexcept { return total_; }
+    [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+
+    /**
+     * @brief Get count for an encoded k-mer (binary search)
+     * @return The count (0 if not present)
+     */
+    [[nodiscard]] size_t getCount(uint64_t code) const noexcept;
+
+    /**
+     * @brief Get count for a k-mer string
+     * @throws KMerError if the k-mer length does not match k
+     */
+    [[nodiscard]] size_t getCount(std::string_view kmer) const;
+
+    /// The sorted (code, count) array
+    [[nodiscard]] std::span<const Entry> entries() const noexcept {
+        return entries_;
+    }
+
+    // Iterator support (entries in ascending code order)
+    [[nodiscard]] auto begin() const noexcept { return entries_.begin(); }
+    [[nodiscard]] auto end() const noexcept { return entries_.end(); }
+
+    /**
+     * @brief Write the profile to disk (header + raw entry array)
+     * @throws KMerError if the file cannot be written
+     */
+    void save(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Load a profile previously written by save()
+     *
+     * The file is memory-mapped and the entry array is read in place;
+     * the bulk payload is never copied or re-parsed.
+     *
+     * @throws KMerError if the file is missing, truncated or malformed
+     */
+    [[nodiscard]] static KMerProfile load(const std::filesystem::path& path);
+
+private:
+    size_t k_ = 0;
+    size_t total_ = 0;
+    std::vector<Entry> owned_;        // backing store for built profiles
+    std::optional<MappedFile> file_;  // backing store for loaded profiles
+    std::span<const Entry> entries_;
+
+    KMerProfile() = default;
+    void sortEntries();
+};
+
+/**
+ * @brief Count-min sketch over encoded k-mer codes
+ *
+ * Fixed-size probabilistic counter: d rows of saturating 8-bit cells,
+ * each row indexed by an independently seeded hashKmerCode(). Estimates
+ * never undercount; collisions can overcount, with error bounded by
+ * the row width. Used as the pre-filter in front of exact counting.
+ */
+class CountMinSketch {
+public:
+    /**
+     * @brief Construct a sketch
+     * @param log2_width Base-2 log of cells per row (total memory is
+     *        depth * 2^log2_width bytes)
+     * @param depth Number of rows
+     * @throws KMerError if depth is 0 or log2_width is out of range
+     */
+    explicit CountMinSketch(size_t log2_width = 22, size_t depth = 4);
+
+    /**
+     * @brief Record one occurrence
+     * @return The (possibly overcounted) estimate after the increment
+     */
+    size_t add(uint64_t code) noexcept;
+
+    /// Estimated occurrences recorded for code (saturates at 255)
+    [[nodiscard]] size_t estimate(uint64_t code) const noexcept;
+
+    [[nodiscard]] size_t memoryUsage() const noexcept {
+        return cells_.size() * sizeof(uint8_t);
+    }
+
+    void clear() noexcept;
+
+private:
+    size_t width_mask_;
+    size_t depth_;
+    std::vector<uint8_t> cells_;  // depth_ rows of width_mask_ + 1 cells
+
+    [[nodiscard]] size_t cellIndex(uint64_t code, size_t row) const noexcept {
+        // Per-row seeds keep the d hash functions independent
+        return row * (width_mask_ + 1) +
+               (hashKmerCode(code ^ (row * 0x9e3779b97f4a7c15ULL)) & width_mask_);
+    }
+};
+
+/**
+ * @brief Exact k-mer counting behind a count-min pre-filter
+ *
+ * On error-rich reads most unique k-mers are sequencing-noise
+ * singletons; keeping them in the exact table is what blows out
+ * memory. Here every occurrence first passes through a fixed-size
+ * CountMinSketch, and a k-mer enters the exact EncodedKMerCounter only
+ * once the sketch has seen it threshold times (the absorbed early
+ * occurrences are credited on admission). Singletons therefore cost
+ * sketch cells instead of table slots.
+ *
+ * Counts for admitted k-mers are exact apart from the sketch's
+ * one-sided error: a collision can admit a noise k-mer early, never
+ * drop a real one. spectrum() estimates singleton_count and
+ * unique_kmers from the occurrences the sketch absorbed.
+ */
+class PrefilteredKMerCounter {
+public:
+    /**
+     * @brief Construct a pre-filtered counter
+     * @param k K-mer length (1-32)
+     * @param threshold Occurrences required to enter the exact table
+     * @param log2_sketch_width Base-2 log of sketch cells per row
+     * @throws KMerError on invalid k or a threshold of 0
+     */
+    explicit PrefilteredKMerCounter(size_t k, size_t threshold = 2,
+                                    size_t log2_sketch_width = 22);
+
+    void count(const Sequence& seq);
+    void countRaw(std::string_view bases);
+
+    // Queries over the exact table (k-mers still below the admission
+    // threshold report 0)
+    [[nodiscard]] size_t getCount(std::string_view kmer) const;
+    [[nodiscard]] size_t getCount(uint64_t code) const noexcept;
+    [[nodiscard]] std::vector<KMerEntry> mostFrequent(size_t n) const;
+    [[nodiscard]] std::vector<KMerEntry> aboveThreshold(size_t threshold) const;
+
+    /**
+     * @brief Spectrum with sketch-estimated singleton fields
+     *
+     * total_kmers is exact; unique_kmers and singleton_count include
+     * the estimated k-mers still absorbed by the sketch.
+     */
+    [[nodiscard]] KMerSpectrum spectrum() const;
+
+    // Accessors
+    [[nodiscard]] size_t uniqueCount() const noexcept { return exact_.uniqueCount(); }
     [[nodiscard]] size_t totalCount() const noexcept { return total_; }
+    [[nodiscard]] size_t k() const noexcept { return exact_.k(); }
+    [[nodiscard]] size_t threshold() const noexcept { return threshold_; }
+    [[nodiscard]] size_t sketchMemoryUsage() const noexcept {
+        return sketch_.memoryUsage();
+    }
+
+    void clear() noexcept;
+
+private:
+    size_t threshold_;
+    CountMinSketch sketch_;
+    EncodedKMerCounter exact_;
+    size_t total_ = 0;     // every counted occurrence
+    size_t absorbed_ = 0;  // occurrences held only by the sketch
+};
+
+/**
+ * @brief A (w,k)-minimizer: one selected k-mer and its position
+ */
+struct Minimizer {
+    uint64_t code;    // Canonical 2-bit code of the selected k-mer
+    size_t position;  // 0-based position of the k-mer in the sequence
+
+    bool operator==(const Minimizer&) const = default;
+};
+
+/**
+ * @brief Compute the (w,k)-minimizers of a sequence
+ *
+ * For every window of w consecutive k-mers, the k-mer with the
+ * smallest hashKmerCode() of its canonical code is selected; each
+ * selected (code, position) is reported once. Uses a monotonic deque,
+ * so the scan is O(n). Windows containing N restart the scan, matching
+ * the counters.
+ *
+ * @param bases Sequence bases
+ * @param k K-mer length (1-32)
+ * @param w Window size in k-mers (>= 1)
+ * @throws KMerError on invalid k or w
+ */
+[[nodiscard]] std::vector<Minimizer> computeMinimizers(
+    std::string_view bases, size_t k, size_t w);
+
+/**
+ * @brief Minimizer index over a reference for seed-and-extend mapping
+ *
+ * Stores the reference's (w,k)-minimizers in a hash-to-positions table.
+ * findCandidates() looks up a read's minimizers, clusters the hits by
+ * diagonal, and returns the few reference windows worth aligning, so
+ * callers run bandedSmithWaterman() on candidate regions instead of
+ * O(mn) whole-reference alignments:
+ * @code
+ * MinimizerIndex index(15, 10);
+ * index.build(reference);
+ * for (const auto& region : index.findCandidates(read)) {
+ *     auto window = reference.subsequence(region.start,
+ *                                         region.end - region.start);
+ *     auto alignment = bandedSmithWaterman(read, window, 32);
+ * }
+ * @endcode
+ */
+class MinimizerIndex {
+public:
+    /**
+     * @brief A reference window likely to contain the read
+     */
+    struct CandidateRegion {
+        size_t start;  // Reference start (inclusive)
+        size_t end;    // Reference end (exclusive)
+        size_t hits;   // Minimizer hits supporting this region
+    };
+
+    /**
+     * @brief Construct an index for (w,k)-minimizers
+     * @throws KMerError on invalid k or w
+     */
+    MinimizerIndex(size_t k, size_t w);
+
+    /// Index a reference, replacing any previous contents
+    void build(const Sequence& reference);
+
+    /**
+     * @brief Candidate reference regions for a read
+     *
+     * Hits sharing a diagonal (reference position minus read position)
+     * are clustered into one region, padded by the window size so the
+     * banded extension has slack. Regions are ordered by hit count,
+     * best first.
+     *
+     * @param read The read to place
+     * @param min_hits Minimum clustered hits to report a region
+     */
+    [[nodiscard]] std::vector<CandidateRegion> findCandidates(
+        const Sequence& read, size_t min_hits = 2) const;
+
+    /// Reference positions of one minimizer code (empty if absent)
+    [[nodiscard]] std::vector<size_t> positionsOf(uint64_t code) const;
+
     [[nodiscard]] size_t k() const noexcept { return k_; }
+    [[nodiscard]] size_t w() const noexcept { return w_; }
+    [[nodiscard]] size_t uniqueMinimizers() const noexcept { return index_.size(); }
+    [[nodiscard]] size_t referenceLength() const noexcept { return reference_length_; }
+    [[nodiscard]] bool empty() const noexcept { return index_.empty(); }
 
 private:
     size_t k_;
-    std::unordered_map<std::string, size_t> counts_;
-    size_t total_ = 0;
+    size_t w_;
+    std::unordered_map<uint64_t, std::vector<size_t>> index_;
+    size_t reference_length_ = 0;
 };
 
 } // namespace bioflow
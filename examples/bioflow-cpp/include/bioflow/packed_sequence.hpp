@@ -0,0 +1,109 @@
+#pragma once
+
+#include "bioflow/sequence.hpp"
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <optional>
+
+namespace bioflow {
+
+/**
+ * @brief DNA sequence stored at 2 bits per base
+ *
+ * Stores A/C/G/T as 2-bit codes (A=0, C=1, G=2, T=3) packed 32 bases per
+ * 64-bit word, with a separate 1-bit-per-base mask recording ambiguous (N)
+ * positions. This gives a 4x memory reduction over the std::string storage
+ * in Sequence, and lets content analysis and complement operations work on
+ * whole words instead of individual characters:
+ * - gcContent()/baseComposition() count bases via bit masks and popcount
+ * - complement() is a bitwise NOT per word
+ * - reverseComplement() is a table-driven byte reversal
+ *
+ * Satisfies the SequenceLike concept; bases() decodes lazily into a cached
+ * string, so packed storage stays the only persistent copy.
+ */
+class PackedSequence {
+public:
+    static constexpr size_t kBasesPerWord = 32;
+
+    // Constructors
+    explicit PackedSequence(std::string_view bases);
+    PackedSequence(std::string_view bases, std::string id);
+    explicit PackedSequence(const Sequence& seq);
+
+    // Default special members
+    PackedSequence(const PackedSequence&) = default;
+    PackedSequence(PackedSequence&&) noexcept = default;
+    PackedSequence& operator=(const PackedSequence&) = default;
+    PackedSequence& operator=(PackedSequence&&) noexcept = default;
+    ~PackedSequence() = default;
+
+    // Getters
+    [[nodiscard]] const std::string& bases() const;
+    [[nodiscard]] size_t length() const noexcept { return length_; }
+    [[nodiscard]] const std::optional<std::string>& id() const noexcept { return id_; }
+    [[nodiscard]] bool empty() const noexcept { return length_ == 0; }
+
+    // Element access (decodes a single base)
+    [[nodiscard]] char operator[](size_t index) const noexcept;
+    [[nodiscard]] char at(size_t index) const;
+
+    // Validation
+    [[nodiscard]] bool hasAmbiguousBases() const noexcept;
+
+    // Content analysis (word-at-a-time bit operations)
+    [[nodiscard]] double gcContent() const noexcept;
+    [[nodiscard]] double atContent() const noexcept;
+    [[nodiscard]] size_t countBase(char base) const noexcept;
+    [[nodiscard]] std::array<size_t, 5> baseComposition() const noexcept;
+
+    // Transformations - return new sequences (immutable design)
+    [[nodiscard]] PackedSequence complement() const;
+    [[nodiscard]] PackedSequence reverseComplement() const;
+    [[nodiscard]] PackedSequence subsequence(size_t start, size_t length) const;
+
+    // Conversion
+    [[nodiscard]] Sequence unpack() const;
+    [[nodiscard]] std::string toString() const;
+
+    // Operators
+    [[nodiscard]] bool operator==(const PackedSequence& other) const noexcept;
+
+    // Storage introspection
+    [[nodiscard]] size_t memoryUsage() const noexcept;
+    [[nodiscard]] const std::vector<uint64_t>& words() const noexcept { return words_; }
+
+    // 2-bit base codes
+    [[nodiscard]] static constexpr uint8_t encodeBase(char c) noexcept {
+        switch (c) {
+            case 'A': case 'a': return 0;
+            case 'C': case 'c': return 1;
+            case 'G': case 'g': return 2;
+            case 'T': case 't': return 3;
+            default: return 0;  // N placeholder; tracked in the N-mask
+        }
+    }
+
+    [[nodiscard]] static constexpr char decodeBase(uint8_t code) noexcept {
+        constexpr char bases[4] = {'A', 'C', 'G', 'T'};
+        return bases[code & 0x3];
+    }
+
+private:
+    size_t length_ = 0;
+    std::vector<uint64_t> words_;   // 2-bit codes, LSB-first, 32 bases/word
+    std::vector<uint64_t> n_mask_;  // 1 bit per base; set where base is N
+    std::optional<std::string> id_;
+    mutable std::string decoded_cache_;  // lazily filled by bases()
+
+    PackedSequence() = default;
+
+    void packFrom(std::string_view bases);
+    [[nodiscard]] bool isN(size_t index) const noexcept;
+    [[nodiscard]] uint64_t tailWordMask() const noexcept;
+};
+
+} // namespace bioflow
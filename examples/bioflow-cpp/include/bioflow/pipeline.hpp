@@ -0,0 +1,135 @@
+#pragma once
+
+#include "bioflow/bounded_queue.hpp"
+#include "bioflow/io.hpp"
+#include "bioflow/string_arena.hpp"
+#include "bioflow/kmer.hpp"
+#include "bioflow/quality.hpp"
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bioflow {
+
+/**
+ * @brief Exception class for pipeline errors
+ */
+class PipelineError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/// Unit of work flowing between pipeline stages
+using RecordBatch = std::vector<QualifiedSequence>;
+
+/**
+ * @brief Configuration for a FastqPipeline run
+ */
+struct PipelineConfig {
+    size_t batch_size = 1024;     // records per batch
+    size_t queue_depth = 8;       // batches buffered between stages
+    size_t worker_threads = 0;    // 0 = hardware concurrency
+    QualityEncoding encoding = QualityEncoding::Phred33;
+    uint8_t trim_quality = 0;     // 0 disables quality trimming
+    double min_mean_quality = 0.0;
+    std::optional<size_t> min_length;
+    std::optional<size_t> max_length;
+};
+
+/**
+ * @brief Counters accumulated across a pipeline run
+ */
+struct PipelineStats {
+    size_t records_parsed = 0;
+    size_t records_passed = 0;  // survived trim + filter
+    size_t bases_parsed = 0;
+    size_t bases_passed = 0;    // post-trim bases of surviving records
+
+    [[nodiscard]] double passRate() const noexcept {
+        return records_parsed > 0
+            ? static_cast<double>(records_passed) / records_parsed
+            : 0.0;
+    }
+};
+
+/**
+ * @brief Pipelined FASTQ processing: parse -> trim -> filter -> sink
+ *
+ * A dedicated reader thread parses record batches from the mapped file
+ * and feeds them through a bounded queue to a pool of workers, which
+ * quality-trim (QualifiedSequence::trim) and filter (the same criteria
+ * as makeQualityFilter()) each record. Parsing therefore overlaps with
+ * compute, and the bounded queues keep whichever stage is slowest from
+ * being starved or flooded by the others. Record IDs are interned into
+ * a pipeline-owned StringArena, so they stay valid for the pipeline's
+ * lifetime and cost no per-record allocation.
+ *
+ * Two terminal stages are provided: run() hands surviving batches to a
+ * caller-supplied sink invoked serially on the calling thread, and
+ * countKmers() counts canonical k-mers into per-worker tables that are
+ * merged at the end:
+ * @code
+ * FastqPipeline pipeline("reads.fastq", {.trim_quality = 20,
+ *                                        .min_mean_quality = 25.0});
+ * auto [counter, stats] = pipeline.countKmers(21);
+ * @endcode
+ */
+class FastqPipeline {
+public:
+    /// Serial consumer for surviving record batches
+    using BatchSink = std::function<void(RecordBatch&&)>;
+
+    /// Result of a counting run
+    struct KmerCountResult {
+        EncodedKMerCounter counter;
+        PipelineStats stats;
+    };
+
+    /**
+     * @brief Open and map a FASTQ file
+     * @throws IOError if the file cannot be mapped
+     */
+    explicit FastqPipeline(const std::string& path,
+                           PipelineConfig config = PipelineConfig{});
+
+    /**
+     * @brief Process an in-memory buffer (not owned by the pipeline)
+     */
+    explicit FastqPipeline(std::string_view buffer,
+                           PipelineConfig config = PipelineConfig{});
+
+    /**
+     * @brief Run the pipeline, delivering batches to a serial sink
+     *
+     * The sink runs on the calling thread, so it needs no locking.
+     * Exceptions from any stage (including the sink) are rethrown here
+     * after the pipeline shuts down.
+     */
+    PipelineStats run(const BatchSink& sink);
+
+    /**
+     * @brief Run the pipeline with a canonical k-mer counting stage
+     *
+     * Each worker counts surviving records into a private table;
+     * tables are merged after the run.
+     */
+    [[nodiscard]] KmerCountResult countKmers(size_t k);
+
+    [[nodiscard]] const PipelineConfig& config() const noexcept { return config_; }
+
+private:
+    PipelineConfig config_;
+    std::optional<MappedFile> file_;
+    std::string_view buffer_;
+    StringArena ids_;  // backs record IDs; lives as long as the pipeline
+
+    // Shared by both terminal stages: reader thread plus trim/filter
+    // workers that hand each surviving batch to consume(batch, worker)
+    PipelineStats pump(
+        const std::function<void(RecordBatch&&, size_t worker)>& consume);
+};
+
+} // namespace bioflow
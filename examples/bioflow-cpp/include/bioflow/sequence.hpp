@@ -104,8 +104,34 @@ private:
     static void validateBases(std::string_view bases);
     [[nodiscard]] static constexpr char toUpper(char c) noexcept;
     [[nodiscard]] static constexpr char complementBase(char c) noexcept;
+
+    friend Sequence makeSequenceUnchecked(std::string bases);
 };
 
+// Constexpr member definitions (must live in the header to be usable in
+// constant expressions and other translation units)
+constexpr char Sequence::toUpper(char c) noexcept {
+    if (c >= 'a' && c <= 'z') {
+        return static_cast<char>(c - 'a' + 'A');
+    }
+    return c;
+}
+
+constexpr bool Sequence::isValidBase(char c) noexcept {
+    c = toUpper(c);
+    return c == 'A' || c == 'C' || c == 'G' || c == 'T' || c == 'N';
+}
+
+constexpr char Sequence::complementBase(char c) noexcept {
+    switch (c) {
+        case 'A': return 'T';
+        case 'T': return 'A';
+        case 'C': return 'G';
+        case 'G': return 'C';
+        default: return 'N';
+    }
+}
+
 // Factory functions
 [[nodiscard]] Sequence makeSequence(std::string_view bases);
 [[nodiscard]] Sequence makeSequenceUnchecked(std::string bases);
@@ -21,6 +21,62 @@ namespace stats {
 // Basic Statistical Functions (Generic)
 // ============================================================================
 
+/**
+ * @brief Single-pass mean/variance accumulator (Welford's algorithm)
+ *
+ * Numerically stable running moments: feed values one at a time (or
+ * merge partial accumulators) and read mean/variance/stddev at any
+ * point. Use this instead of variance() when the data is streamed or
+ * too large to walk twice.
+ */
+class RunningStats {
+public:
+    void add(double value) noexcept {
+        count_++;
+        double delta = value - mean_;
+        mean_ += delta / static_cast<double>(count_);
+        m2_ += delta * (value - mean_);
+    }
+
+    /// Fold another accumulator in (Chan's parallel combination)
+    void merge(const RunningStats& other) noexcept {
+        if (other.count_ == 0) return;
+        if (count_ == 0) {
+            *this = other;
+            return;
+        }
+
+        size_t combined = count_ + other.count_;
+        double delta = other.mean_ - mean_;
+        mean_ += delta * static_cast<double>(other.count_) /
+                 static_cast<double>(combined);
+        m2_ += other.m2_ + delta * delta *
+               static_cast<double>(count_) *
+               static_cast<double>(other.count_) /
+               static_cast<double>(combined);
+        count_ = combined;
+    }
+
+    [[nodiscard]] size_t count() const noexcept { return count_; }
+    [[nodiscard]] double mean() const noexcept { return mean_; }
+
+    /// Sample variance (n-1 denominator, matching variance())
+    [[nodiscard]] double variance() const noexcept {
+        return count_ > 1 ? m2_ / static_cast<double>(count_ - 1) : 0.0;
+    }
+
+    [[nodiscard]] double standardDeviation() const noexcept {
+        return std::sqrt(variance());
+    }
+
+    void clear() noexcept { *this = RunningStats{}; }
+
+private:
+    size_t count_ = 0;
+    double mean_ = 0.0;
+    double m2_ = 0.0;
+};
+
 /**
  * @brief Compute mean of a range of values
  */
@@ -45,27 +101,18 @@ template<std::ranges::range R>
 
 /**
  * @brief Compute variance of a range of values
+ *
+ * Single pass via RunningStats, so the range is only walked once.
  */
 template<std::ranges::range R>
     requires std::floating_point<std::ranges::range_value_t<R>> ||
              std::integral<std::ranges::range_value_t<R>>
 [[nodiscard]] double variance(R&& values) {
-    auto begin = std::ranges::begin(values);
-    auto end = std::ranges::end(values);
-
-    if (begin == end) return 0.0;
-
-    double m = mean(values);
-    double sum_sq = 0.0;
-    size_t count = 0;
-
-    for (auto it = begin; it != end; ++it) {
-        double diff = static_cast<double>(*it) - m;
-        sum_sq += diff * diff;
-        ++count;
+    RunningStats accumulator;
+    for (const auto& v : values) {
+        accumulator.add(static_cast<double>(v));
     }
-
-    return count > 1 ? sum_sq / (count - 1) : 0.0;
+    return accumulator.variance();
 }
 
 /**
@@ -80,26 +127,34 @@ template<std::ranges::range R>
 
 /**
  * @brief Compute median of a range of values
+ *
+ * Selects with nth_element (O(n) expected) instead of a full sort.
+ * The scratch copy keeps the element type, so contiguous integer
+ * spans copy with memcpy rather than converting element-by-element.
  */
 template<std::ranges::range R>
     requires std::floating_point<std::ranges::range_value_t<R>> ||
              std::integral<std::ranges::range_value_t<R>>
 [[nodiscard]] double median(R&& values) {
-    std::vector<double> sorted;
-    for (const auto& v : values) {
-        sorted.push_back(static_cast<double>(v));
-    }
+    using T = std::ranges::range_value_t<R>;
+    std::vector<T> scratch(std::ranges::begin(values),
+                           std::ranges::end(values));
 
-    if (sorted.empty()) return 0.0;
+    if (scratch.empty()) return 0.0;
 
-    std::ranges::sort(sorted);
-    size_t n = sorted.size();
+    size_t n = scratch.size();
+    auto mid = scratch.begin() + static_cast<std::ptrdiff_t>(n / 2);
+    std::nth_element(scratch.begin(), mid, scratch.end());
 
-    if (n % 2 == 0) {
-        return (sorted[n/2 - 1] + sorted[n/2]) / 2.0;
-    } else {
-        return sorted[n/2];
+    if (n % 2 != 0) {
+        return static_cast<double>(*mid);
     }
+
+    // nth_element leaves the lower half before mid; its max is the
+    // other middle element
+    double lower = static_cast<double>(
+        *std::max_element(scratch.begin(), mid));
+    return (lower + static_cast<double>(*mid)) / 2.0;
 }
 
 /**
@@ -111,25 +166,31 @@ template<std::ranges::range R>
     requires std::floating_point<std::ranges::range_value_t<R>> ||
              std::integral<std::ranges::range_value_t<R>>
 [[nodiscard]] double percentile(R&& values, double p) {
-    std::vector<double> sorted;
-    for (const auto& v : values) {
-        sorted.push_back(static_cast<double>(v));
-    }
+    using T = std::ranges::range_value_t<R>;
+    std::vector<T> scratch(std::ranges::begin(values),
+                           std::ranges::end(values));
 
-    if (sorted.empty()) return 0.0;
+    if (scratch.empty()) return 0.0;
 
-    std::ranges::sort(sorted);
-
-    double index = (p / 100.0) * (sorted.size() - 1);
+    double index = (p / 100.0) * (scratch.size() - 1);
     size_t lower = static_cast<size_t>(std::floor(index));
     size_t upper = static_cast<size_t>(std::ceil(index));
 
+    auto lower_it = scratch.begin() + static_cast<std::ptrdiff_t>(lower);
+    std::nth_element(scratch.begin(), lower_it, scratch.end());
+    double lower_value = static_cast<double>(*lower_it);
+
     if (lower == upper) {
-        return sorted[lower];
+        return lower_value;
     }
 
+    // Everything after the selected element is >= it, so the next
+    // order statistic is that suffix's minimum
+    double upper_value = static_cast<double>(
+        *std::min_element(lower_it + 1, scratch.end()));
+
     double fraction = index - lower;
-    return sorted[lower] * (1 - fraction) + sorted[upper] * fraction;
+    return lower_value * (1 - fraction) + upper_value * fraction;
 }
 
 // ============================================================================
@@ -207,9 +268,19 @@ struct CollectionStats {
 
 /**
  * @brief Compute statistics for a collection of sequences
+ *
+ * Per-sequence values (length, GC content) are computed in parallel
+ * with per-thread partial accumulators merged at the end, so assembly-
+ * scale collections use every core. Length-derived fields (median, min,
+ * max, N50/L50) are exact; floating-point summaries agree with the
+ * serial result to rounding.
+ *
+ * @param sequences The collection to summarize
+ * @param num_threads Worker count (0 = hardware concurrency)
  */
 [[nodiscard]] CollectionStats computeCollectionStats(
-    const std::vector<Sequence>& sequences
+    const std::vector<Sequence>& sequences,
+    size_t num_threads = 0
 );
 
 /**
@@ -259,8 +330,39 @@ struct KMerStats {
 // Comparative Statistics
 // ============================================================================
 
+/**
+ * @brief Jaccard similarity between two frozen k-mer profiles
+ *
+ * Linear merge-join over the two sorted entry arrays. Build the
+ * profiles once per sample and reuse them for every pairwise call in
+ * an all-vs-all comparison matrix.
+ */
+[[nodiscard]] double jaccardSimilarity(
+    const KMerProfile& profile1,
+    const KMerProfile& profile2
+);
+
+/**
+ * @brief Cosine similarity between two frozen k-mer profiles
+ */
+[[nodiscard]] double cosineSimilarity(
+    const KMerProfile& profile1,
+    const KMerProfile& profile2
+);
+
+/**
+ * @brief Bray-Curtis dissimilarity between two frozen k-mer profiles
+ */
+[[nodiscard]] double brayCurtisDissimilarity(
+    const KMerProfile& profile1,
+    const KMerProfile& profile2
+);
+
 /**
  * @brief Jaccard similarity between two k-mer sets
+ *
+ * Convenience overload: snapshots both counters into KMerProfiles and
+ * delegates. Prefer the profile overload when comparing many pairs.
  */
 [[nodiscard]] double jaccardSimilarity(
     const KMerCounter& counter1,
@@ -297,43 +399,70 @@ struct HistogramBin {
 };
 
 /**
- * @brief Create histogram from values
+ * @brief Create histogram from values with known bounds
+ *
+ * Bins in a single streaming pass; values outside [min_val, max_val]
+ * are clamped into the edge bins.
  */
 template<std::ranges::range R>
     requires std::floating_point<std::ranges::range_value_t<R>> ||
              std::integral<std::ranges::range_value_t<R>>
-[[nodiscard]] std::vector<HistogramBin> histogram(R&& values, size_t num_bins) {
-    std::vector<double> vec;
-    for (const auto& v : values) {
-        vec.push_back(static_cast<double>(v));
-    }
-
-    if (vec.empty() || num_bins == 0) return {};
-
-    auto [min_it, max_it] = std::ranges::minmax_element(vec);
-    double min_val = *min_it;
-    double max_val = *max_it;
+[[nodiscard]] std::vector<HistogramBin> histogram(R&& values, size_t num_bins,
+                                                  double min_val, double max_val) {
+    if (num_bins == 0 || min_val > max_val) return {};
 
     if (min_val == max_val) {
-        return {{min_val, max_val, vec.size()}};
+        size_t count = 0;
+        for ([[maybe_unused]] const auto& v : values) {
+            ++count;
+        }
+        if (count == 0) return {};
+        return {{min_val, max_val, count}};
     }
 
-    double bin_width = (max_val - min_val) / num_bins;
+    double bin_width = (max_val - min_val) / static_cast<double>(num_bins);
     std::vector<HistogramBin> bins(num_bins);
 
     for (size_t i = 0; i < num_bins; ++i) {
-        bins[i].lower = min_val + i * bin_width;
-        bins[i].upper = min_val + (i + 1) * bin_width;
+        bins[i].lower = min_val + static_cast<double>(i) * bin_width;
+        bins[i].upper = min_val + static_cast<double>(i + 1) * bin_width;
         bins[i].count = 0;
     }
 
-    for (double v : vec) {
-        size_t bin_idx = static_cast<size_t>((v - min_val) / bin_width);
-        if (bin_idx >= num_bins) bin_idx = num_bins - 1;
+    size_t total = 0;
+    for (const auto& v : values) {
+        double value = static_cast<double>(v);
+        double offset = (value - min_val) / bin_width;
+        size_t bin_idx = offset <= 0.0
+            ? 0
+            : std::min(static_cast<size_t>(offset), num_bins - 1);
         bins[bin_idx].count++;
+        ++total;
     }
 
-    return bins;
+    return total > 0 ? bins : std::vector<HistogramBin>{};
+}
+
+/**
+ * @brief Create histogram from values
+ *
+ * Two direct scans of the range (bounds, then binning) with no
+ * intermediate copy.
+ */
+template<std::ranges::range R>
+    requires std::floating_point<std::ranges::range_value_t<R>> ||
+             std::integral<std::ranges::range_value_t<R>>
+[[nodiscard]] std::vector<HistogramBin> histogram(R&& values, size_t num_bins) {
+    if (num_bins == 0) return {};
+
+    auto begin = std::ranges::begin(values);
+    auto end = std::ranges::end(values);
+    if (begin == end) return {};
+
+    auto [min_it, max_it] = std::ranges::minmax_element(values);
+    return histogram(std::forward<R>(values), num_bins,
+                     static_cast<double>(*min_it),
+                     static_cast<double>(*max_it));
 }
 
 } // namespace stats
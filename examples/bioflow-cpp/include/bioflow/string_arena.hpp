@@ -0,0 +1,123 @@
+#pragma once
+
+#include <compare>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace bioflow {
+
+/**
+ * @brief Append-only arena for short strings (sequence IDs)
+ *
+ * Interning copies a string into a large shared block and returns a
+ * view that stays valid for the arena's lifetime, so millions of
+ * per-record IDs cost a handful of block allocations instead of one
+ * heap string each. Blocks are never resized or freed until the arena
+ * is destroyed, which is what makes the returned views stable.
+ *
+ * Not thread-safe; in the pipeline a single parsing thread owns the
+ * arena.
+ */
+class StringArena {
+public:
+    static constexpr size_t kDefaultBlockSize = size_t{64} * 1024;
+
+    explicit StringArena(size_t block_size = kDefaultBlockSize);
+
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+    StringArena(StringArena&&) noexcept = default;
+    StringArena& operator=(StringArena&&) noexcept = default;
+
+    /**
+     * @brief Copy a string into the arena
+     * @return A view of the copy, valid for the arena's lifetime
+     */
+    [[nodiscard]] std::string_view intern(std::string_view text);
+
+    /// Total bytes interned (not counting block slack)
+    [[nodiscard]] size_t bytesStored() const noexcept { return bytes_stored_; }
+
+    /// Number of blocks allocated so far
+    [[nodiscard]] size_t blockCount() const noexcept { return blocks_.size(); }
+
+private:
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t capacity;
+        size_t used;
+    };
+
+    std::vector<Block> blocks_;
+    size_t block_size_;
+    size_t bytes_stored_ = 0;
+};
+
+/**
+ * @brief A sequence ID that either owns its characters or borrows them
+ *
+ * Borrowed IDs are views into a StringArena (or any buffer the caller
+ * keeps alive, such as a mapped file) and cost nothing to create or
+ * copy; owned IDs fall back to std::string, whose small-string
+ * optimization covers typical short IDs without a heap allocation.
+ * Comparisons and printing always go by character value, so the two
+ * storage modes are interchangeable to callers.
+ */
+class InternedString {
+public:
+    /// Empty owned string
+    InternedString() = default;
+
+    /// Owning: takes over the string's storage
+    InternedString(std::string owned) : storage_(std::move(owned)) {}
+
+    /// Owning: copies a literal or C string
+    InternedString(const char* text) : storage_(std::string(text)) {}
+
+    /// Borrowing: the caller guarantees the view outlives this ID
+    [[nodiscard]] static InternedString borrowed(std::string_view view) {
+        InternedString id;
+        id.storage_ = view;
+        return id;
+    }
+
+    [[nodiscard]] std::string_view view() const noexcept {
+        return std::visit(
+            [](const auto& s) { return std::string_view(s); }, storage_);
+    }
+
+    operator std::string_view() const noexcept { return view(); }
+
+    /// Owning copy of the characters
+    [[nodiscard]] std::string str() const { return std::string(view()); }
+
+    [[nodiscard]] size_t size() const noexcept { return view().size(); }
+    [[nodiscard]] bool empty() const noexcept { return view().empty(); }
+
+    /// True if this ID borrows storage it does not own
+    [[nodiscard]] bool isBorrowed() const noexcept {
+        return std::holds_alternative<std::string_view>(storage_);
+    }
+
+    [[nodiscard]] bool operator==(std::string_view other) const noexcept {
+        return view() == other;
+    }
+    [[nodiscard]] std::strong_ordering operator<=>(
+        std::string_view other) const noexcept {
+        return view() <=> other;
+    }
+
+private:
+    std::variant<std::string, std::string_view> storage_;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const InternedString& id) {
+    return os << id.view();
+}
+
+} // namespace bioflow
@@ -1,8 +1,21 @@
 #include "bioflow/alignment.hpp"
+#include "bioflow/instrument.hpp"
+#include "bioflow/kmer.hpp"
+#include "bioflow/stats.hpp"
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <deque>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <limits>
 
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 namespace bioflow {
 
 // ============================================================================
@@ -108,38 +121,115 @@ std::string Alignment::prettyPrint(size_t line_width) const {
 }
 
 // ============================================================================
-// Smith-Waterman Algorithm
+// Aligner (arena-backed DP)
 // ============================================================================
 
-Alignment smithWaterman(
-    const Sequence& seq1,
-    const Sequence& seq2,
-    const ScoringMatrix& scoring
-) {
+void Aligner::reserveMatrix(size_t rows, size_t cols) {
+    BIOFLOW_COUNT(dp_cells_filled, rows * cols);
+    cols_ = cols;
+    size_t needed = rows * cols;
+    if (score_.size() < needed) {
+        score_.resize(needed);
+        trace_.resize(needed);
+    }
+}
+
+void Aligner::reserveAffineMatrix(size_t rows, size_t cols) {
+    reserveMatrix(rows, cols);
+    size_t needed = rows * cols;
+    if (up_score_.size() < needed) {
+        up_score_.resize(needed);
+        left_score_.resize(needed);
+        up_extend_.resize(needed);
+        left_extend_.resize(needed);
+    }
+}
+
+Alignment Aligner::tracebackFrom(std::string_view s1, std::string_view s2,
+                                 size_t i, size_t j, bool local) const {
+    Alignment result;
+    result.matches = 0;
+    result.mismatches = 0;
+    result.gaps = 0;
+
+    // Build reversed and flip once at the end; prepending per step would
+    // be quadratic in the alignment length
+    std::string aligned1, aligned2;
+    aligned1.reserve(i + j);
+    aligned2.reserve(i + j);
+
+    auto keep_going = [&] {
+        if (local) {
+            return i > 0 && j > 0 && score_[i * cols_ + j] > 0;
+        }
+        return i > 0 || j > 0;
+    };
+
+    while (keep_going()) {
+        TraceDirection dir = trace_[i * cols_ + j];
+
+        if (i > 0 && j > 0 && dir == TraceDirection::Diagonal) {
+            aligned1 += s1[i-1];
+            aligned2 += s2[j-1];
+            if (s1[i-1] == s2[j-1]) {
+                result.matches++;
+            } else {
+                result.mismatches++;
+            }
+            --i;
+            --j;
+        } else if (i > 0 && (j == 0 || dir == TraceDirection::Up)) {
+            aligned1 += s1[i-1];
+            aligned2 += '-';
+            result.gaps++;
+            --i;
+        } else if (j > 0 && (i == 0 || dir == TraceDirection::Left)) {
+            aligned1 += '-';
+            aligned2 += s2[j-1];
+            result.gaps++;
+            --j;
+        } else {
+            break;  // local alignment hit a None cell
+        }
+    }
+
+    std::reverse(aligned1.begin(), aligned1.end());
+    std::reverse(aligned2.begin(), aligned2.end());
+
+    result.aligned_seq1 = std::move(aligned1);
+    result.aligned_seq2 = std::move(aligned2);
+    result.start1 = i;
+    result.start2 = j;
+
+    return result;
+}
+
+Alignment Aligner::smithWaterman(const Sequence& seq1, const Sequence& seq2) {
     const auto& s1 = seq1.bases();
     const auto& s2 = seq2.bases();
     const size_t m = s1.length();
     const size_t n = s2.length();
 
-    // Create scoring and traceback matrices
-    std::vector<std::vector<int>> score_matrix(m + 1, std::vector<int>(n + 1, 0));
-    std::vector<std::vector<TraceDirection>> trace(m + 1,
-        std::vector<TraceDirection>(n + 1, TraceDirection::None));
+    reserveMatrix(m + 1, n + 1);
+
+    // Local alignment: free edges
+    for (size_t j = 0; j <= n; ++j) {
+        scoreAt(0, j) = 0;
+        traceAt(0, j) = TraceDirection::None;
+    }
+    for (size_t i = 0; i <= m; ++i) {
+        scoreAt(i, 0) = 0;
+        traceAt(i, 0) = TraceDirection::None;
+    }
 
     int max_score = 0;
     size_t max_i = 0, max_j = 0;
 
-    // Fill matrices
     for (size_t i = 1; i <= m; ++i) {
         for (size_t j = 1; j <= n; ++j) {
-            // Match/mismatch
-            int match = score_matrix[i-1][j-1] + scoring.score(s1[i-1], s2[j-1]);
-
-            // Gap in seq2 (deletion from seq1)
-            int delete_gap = score_matrix[i-1][j] + scoring.gapPenalty();
-
-            // Gap in seq1 (insertion in seq2)
-            int insert_gap = score_matrix[i][j-1] + scoring.gapPenalty();
+            int match = scoreAt(i-1, j-1) + scoring_.score(s1[i-1], s2[j-1]);
+            int delete_gap = scoreAt(i-1, j) + scoring_.gapPenalty();
+            int insert_gap = scoreAt(i, j-1) + scoring_.gapPenalty();
 
             // Take maximum (including 0 for local alignment)
             int best = 0;
@@ -158,10 +248,9 @@ Alignment smithWaterman(
                 dir = TraceDirection::Left;
             }
 
-            score_matrix[i][j] = best;
-            trace[i][j] = dir;
+            scoreAt(i, j) = best;
+            traceAt(i, j) = dir;
 
-            // Track maximum score position
             if (best > max_score) {
                 max_score = best;
                 max_i = i;
@@ -170,97 +259,38 @@ Alignment smithWaterman(
         }
     }
 
-    // Traceback from maximum score
-    Alignment result;
+    Alignment result = tracebackFrom(s1, s2, max_i, max_j, true);
     result.score = max_score;
     result.end1 = max_i - 1;
     result.end2 = max_j - 1;
-    result.matches = 0;
-    result.mismatches = 0;
-    result.gaps = 0;
-
-    std::string aligned1, aligned2;
-    size_t i = max_i, j = max_j;
-
-    while (i > 0 && j > 0 && score_matrix[i][j] > 0) {
-        switch (trace[i][j]) {
-            case TraceDirection::Diagonal:
-                aligned1 = s1[i-1] + aligned1;
-                aligned2 = s2[j-1] + aligned2;
-                if (s1[i-1] == s2[j-1]) {
-                    result.matches++;
-                } else {
-                    result.mismatches++;
-                }
-                --i;
-                --j;
-                break;
-
-            case TraceDirection::Up:
-                aligned1 = s1[i-1] + aligned1;
-                aligned2 = '-' + aligned2;
-                result.gaps++;
-                --i;
-                break;
-
-            case TraceDirection::Left:
-                aligned1 = '-' + aligned1;
-                aligned2 = s2[j-1] + aligned2;
-                result.gaps++;
-                --j;
-                break;
-
-            default:
-                // Should not reach here
-                i = 0;
-                j = 0;
-                break;
-        }
-    }
-
-    result.aligned_seq1 = std::move(aligned1);
-    result.aligned_seq2 = std::move(aligned2);
-    result.start1 = i;
-    result.start2 = j;
-
     return result;
 }
 
-// ============================================================================
-// Needleman-Wunsch Algorithm
-// ============================================================================
-
-Alignment needlemanWunsch(
-    const Sequence& seq1,
-    const Sequence& seq2,
-    const ScoringMatrix& scoring
-) {
+Alignment Aligner::needlemanWunsch(const Sequence& seq1, const Sequence& seq2) {
     const auto& s1 = seq1.bases();
     const auto& s2 = seq2.bases();
     const size_t m = s1.length();
     const size_t n = s2.length();
 
-    // Create scoring and traceback matrices
-    std::vector<std::vector<int>> score_matrix(m + 1, std::vector<int>(n + 1, 0));
-    std::vector<std::vector<TraceDirection>> trace(m + 1,
-        std::vector<TraceDirection>(n + 1, TraceDirection::None));
+    reserveMatrix(m + 1, n + 1);
 
-    // Initialize first row and column with gap penalties
+    // Global alignment: gap penalties along both edges
+    scoreAt(0, 0) = 0;
+    traceAt(0, 0) = TraceDirection::None;
     for (size_t i = 1; i <= m; ++i) {
-        score_matrix[i][0] = static_cast<int>(i) * scoring.gapPenalty();
-        trace[i][0] = TraceDirection::Up;
+        scoreAt(i, 0) = static_cast<int>(i) * scoring_.gapPenalty();
+        traceAt(i, 0) = TraceDirection::Up;
     }
     for (size_t j = 1; j <= n; ++j) {
-        score_matrix[0][j] = static_cast<int>(j) * scoring.gapPenalty();
-        trace[0][j] = TraceDirection::Left;
+        scoreAt(0, j) = static_cast<int>(j) * scoring_.gapPenalty();
+        traceAt(0, j) = TraceDirection::Left;
     }
 
-    // Fill matrices
     for (size_t i = 1; i <= m; ++i) {
         for (size_t j = 1; j <= n; ++j) {
-            int match = score_matrix[i-1][j-1] + scoring.score(s1[i-1], s2[j-1]);
-            int delete_gap = score_matrix[i-1][j] + scoring.gapPenalty();
-            int insert_gap = score_matrix[i][j-1] + scoring.gapPenalty();
+            int match = scoreAt(i-1, j-1) + scoring_.score(s1[i-1], s2[j-1]);
+            int delete_gap = scoreAt(i-1, j) + scoring_.gapPenalty();
+            int insert_gap = scoreAt(i, j-1) + scoring_.gapPenalty();
 
             int best;
             TraceDirection dir;
@@ -276,361 +306,1896 @@ Alignment needlemanWunsch(
                 dir = TraceDirection::Left;
             }
 
-            score_matrix[i][j] = best;
-            trace[i][j] = dir;
+            scoreAt(i, j) = best;
+            traceAt(i, j) = dir;
         }
     }
 
-    // Traceback from bottom-right corner
-    Alignment result;
-    result.score = score_matrix[m][n];
+    Alignment result = tracebackFrom(s1, s2, m, n, false);
+    result.score = scoreAt(m, n);
     result.start1 = 0;
     result.start2 = 0;
     result.end1 = m - 1;
     result.end2 = n - 1;
+    return result;
+}
+
+Alignment Aligner::affineTracebackFrom(std::string_view s1, std::string_view s2,
+                                       size_t i, size_t j, bool local) const {
+    Alignment result;
     result.matches = 0;
     result.mismatches = 0;
     result.gaps = 0;
 
     std::string aligned1, aligned2;
-    size_t i = m, j = n;
-
-    while (i > 0 || j > 0) {
-        if (i > 0 && j > 0 && trace[i][j] == TraceDirection::Diagonal) {
-            aligned1 = s1[i-1] + aligned1;
-            aligned2 = s2[j-1] + aligned2;
-            if (s1[i-1] == s2[j-1]) {
-                result.matches++;
+    aligned1.reserve(i + j);
+    aligned2.reserve(i + j);
+
+    // Which matrix the walk is currently in: the main (match) matrix,
+    // or one of the two gap matrices. Gap runs stay in their matrix
+    // until the cell that opened them, so a single open+extends run is
+    // recovered without re-deriving gap lengths from scores.
+    enum class State { Main, GapUp, GapLeft };
+    State state = State::Main;
+
+    while (true) {
+        if (state == State::Main) {
+            if (local && score_[i * cols_ + j] <= 0) break;
+            if (i == 0 && j == 0) break;
+
+            TraceDirection dir = trace_[i * cols_ + j];
+            if (dir == TraceDirection::Diagonal) {
+                aligned1 += s1[i-1];
+                aligned2 += s2[j-1];
+                if (s1[i-1] == s2[j-1]) {
+                    result.matches++;
+                } else {
+                    result.mismatches++;
+                }
+                --i;
+                --j;
+            } else if (dir == TraceDirection::Up) {
+                state = State::GapUp;
+            } else if (dir == TraceDirection::Left) {
+                state = State::GapLeft;
             } else {
-                result.mismatches++;
+                break;  // local alignment hit a None cell
             }
-            --i;
-            --j;
-        } else if (i > 0 && (j == 0 || trace[i][j] == TraceDirection::Up)) {
-            aligned1 = s1[i-1] + aligned1;
-            aligned2 = '-' + aligned2;
+        } else if (state == State::GapUp) {
+            aligned1 += s1[i-1];
+            aligned2 += '-';
             result.gaps++;
+            bool extended = up_extend_[i * cols_ + j] != 0;
             --i;
+            if (!extended) state = State::Main;
         } else {
-            aligned1 = '-' + aligned1;
-            aligned2 = s2[j-1] + aligned2;
+            aligned1 += '-';
+            aligned2 += s2[j-1];
             result.gaps++;
+            bool extended = left_extend_[i * cols_ + j] != 0;
             --j;
+            if (!extended) state = State::Main;
         }
     }
 
+    std::reverse(aligned1.begin(), aligned1.end());
+    std::reverse(aligned2.begin(), aligned2.end());
+
     result.aligned_seq1 = std::move(aligned1);
     result.aligned_seq2 = std::move(aligned2);
+    result.start1 = i;
+    result.start2 = j;
 
     return result;
 }
 
-// ============================================================================
-// Semi-Global Alignment
-// ============================================================================
+namespace {
 
-Alignment semiGlobalAlignment(
-    const Sequence& seq1,
-    const Sequence& seq2,
-    const ScoringMatrix& scoring
-) {
+// Low enough that adding a gap penalty cannot wrap, high enough to
+// never win a max against a reachable score
+constexpr int kAffineNegInf = std::numeric_limits<int>::min() / 4;
+
+} // namespace
+
+Alignment Aligner::smithWatermanAffine(const Sequence& seq1,
+                                       const Sequence& seq2) {
     const auto& s1 = seq1.bases();
     const auto& s2 = seq2.bases();
     const size_t m = s1.length();
     const size_t n = s2.length();
+    const int open = scoring_.gap_open_penalty;
+    const int extend = scoring_.gap_extend_penalty;
 
-    std::vector<std::vector<int>> score_matrix(m + 1, std::vector<int>(n + 1, 0));
-    std::vector<std::vector<TraceDirection>> trace(m + 1,
-        std::vector<TraceDirection>(n + 1, TraceDirection::None));
+    reserveAffineMatrix(m + 1, n + 1);
 
-    // Initialize first column (gaps in seq1 are free at start)
-    for (size_t i = 1; i <= m; ++i) {
-        score_matrix[i][0] = static_cast<int>(i) * scoring.gapPenalty();
-        trace[i][0] = TraceDirection::Up;
+    // Local alignment: free edges; gap matrices start unreachable
+    for (size_t j = 0; j <= n; ++j) {
+        scoreAt(0, j) = 0;
+        traceAt(0, j) = TraceDirection::None;
+        upAt(0, j) = kAffineNegInf;
+        leftAt(0, j) = kAffineNegInf;
     }
-    // First row: gaps in seq2 are free (semi-global)
-    for (size_t j = 1; j <= n; ++j) {
-        trace[0][j] = TraceDirection::Left;
+    for (size_t i = 0; i <= m; ++i) {
+        scoreAt(i, 0) = 0;
+        traceAt(i, 0) = TraceDirection::None;
+        upAt(i, 0) = kAffineNegInf;
+        leftAt(i, 0) = kAffineNegInf;
     }
 
-    // Fill matrices
+    int max_score = 0;
+    size_t max_i = 0, max_j = 0;
+
     for (size_t i = 1; i <= m; ++i) {
         for (size_t j = 1; j <= n; ++j) {
-            int match = score_matrix[i-1][j-1] + scoring.score(s1[i-1], s2[j-1]);
-            int delete_gap = score_matrix[i-1][j] + scoring.gapPenalty();
-            int insert_gap = score_matrix[i][j-1] + scoring.gapPenalty();
+            int open_up = scoreAt(i-1, j) + open;
+            int extend_up = upAt(i-1, j) + extend;
+            upAt(i, j) = std::max(open_up, extend_up);
+            up_extend_[i * cols_ + j] = extend_up > open_up ? 1 : 0;
 
-            int best;
-            TraceDirection dir;
+            int open_left = scoreAt(i, j-1) + open;
+            int extend_left = leftAt(i, j-1) + extend;
+            leftAt(i, j) = std::max(open_left, extend_left);
+            left_extend_[i * cols_ + j] = extend_left > open_left ? 1 : 0;
 
-            if (match >= delete_gap && match >= insert_gap) {
+            int match = scoreAt(i-1, j-1) + scoring_.score(s1[i-1], s2[j-1]);
+
+            // Take maximum (including 0 for local alignment)
+            int best = 0;
+            TraceDirection dir = TraceDirection::None;
+
+            if (match > best) {
                 best = match;
                 dir = TraceDirection::Diagonal;
-            } else if (delete_gap >= insert_gap) {
-                best = delete_gap;
+            }
+            if (upAt(i, j) > best) {
+                best = upAt(i, j);
                 dir = TraceDirection::Up;
-            } else {
-                best = insert_gap;
+            }
+            if (leftAt(i, j) > best) {
+                best = leftAt(i, j);
                 dir = TraceDirection::Left;
             }
 
-            score_matrix[i][j] = best;
-            trace[i][j] = dir;
-        }
-    }
+            scoreAt(i, j) = best;
+            traceAt(i, j) = dir;
 
-    // Find best score in last row (end gaps in seq2 are free)
-    int max_score = score_matrix[m][0];
-    size_t max_j = 0;
-    for (size_t j = 1; j <= n; ++j) {
-        if (score_matrix[m][j] > max_score) {
-            max_score = score_matrix[m][j];
-            max_j = j;
+            if (best > max_score) {
+                max_score = best;
+                max_i = i;
+                max_j = j;
+            }
         }
     }
 
-    // Traceback
-    Alignment result;
+    Alignment result = affineTracebackFrom(s1, s2, max_i, max_j, true);
     result.score = max_score;
-    result.matches = 0;
-    result.mismatches = 0;
-    result.gaps = 0;
+    result.end1 = max_i - 1;
+    result.end2 = max_j - 1;
+    return result;
+}
 
-    std::string aligned1, aligned2;
-    size_t i = m, j = max_j;
+Alignment Aligner::needlemanWunschAffine(const Sequence& seq1,
+                                         const Sequence& seq2) {
+    const auto& s1 = seq1.bases();
+    const auto& s2 = seq2.bases();
+    const size_t m = s1.length();
+    const size_t n = s2.length();
+    const int open = scoring_.gap_open_penalty;
+    const int extend = scoring_.gap_extend_penalty;
 
-    // Add trailing gaps in seq2 if any
-    for (size_t k = n; k > max_j; --k) {
-        aligned1 = '-' + aligned1;
-        aligned2 = s2[k-1] + aligned2;
-        result.gaps++;
+    reserveAffineMatrix(m + 1, n + 1);
+
+    // Global alignment: the edges are single affine gap runs
+    scoreAt(0, 0) = 0;
+    traceAt(0, 0) = TraceDirection::None;
+    upAt(0, 0) = kAffineNegInf;
+    leftAt(0, 0) = kAffineNegInf;
+    for (size_t i = 1; i <= m; ++i) {
+        scoreAt(i, 0) = scoring_.gapPenalty(i);
+        traceAt(i, 0) = TraceDirection::Up;
+        upAt(i, 0) = scoreAt(i, 0);
+        leftAt(i, 0) = kAffineNegInf;
+        up_extend_[i * cols_] = i > 1 ? 1 : 0;
+    }
+    for (size_t j = 1; j <= n; ++j) {
+        scoreAt(0, j) = scoring_.gapPenalty(j);
+        traceAt(0, j) = TraceDirection::Left;
+        upAt(0, j) = kAffineNegInf;
+        leftAt(0, j) = scoreAt(0, j);
+        left_extend_[j] = j > 1 ? 1 : 0;
     }
 
-    while (i > 0 || j > 0) {
-        if (i > 0 && j > 0 && trace[i][j] == TraceDirection::Diagonal) {
-            aligned1 = s1[i-1] + aligned1;
-            aligned2 = s2[j-1] + aligned2;
-            if (s1[i-1] == s2[j-1]) {
-                result.matches++;
+    for (size_t i = 1; i <= m; ++i) {
+        for (size_t j = 1; j <= n; ++j) {
+            int open_up = scoreAt(i-1, j) + open;
+            int extend_up = upAt(i-1, j) + extend;
+            upAt(i, j) = std::max(open_up, extend_up);
+            up_extend_[i * cols_ + j] = extend_up > open_up ? 1 : 0;
+
+            int open_left = scoreAt(i, j-1) + open;
+            int extend_left = leftAt(i, j-1) + extend;
+            leftAt(i, j) = std::max(open_left, extend_left);
+            left_extend_[i * cols_ + j] = extend_left > open_left ? 1 : 0;
+
+            int match = scoreAt(i-1, j-1) + scoring_.score(s1[i-1], s2[j-1]);
+
+            int best;
+            TraceDirection dir;
+
+            if (match >= upAt(i, j) && match >= leftAt(i, j)) {
+                best = match;
+                dir = TraceDirection::Diagonal;
+            } else if (upAt(i, j) >= leftAt(i, j)) {
+                best = upAt(i, j);
+                dir = TraceDirection::Up;
             } else {
-                result.mismatches++;
+                best = leftAt(i, j);
+                dir = TraceDirection::Left;
             }
-            --i;
-            --j;
-        } else if (i > 0 && (j == 0 || trace[i][j] == TraceDirection::Up)) {
-            aligned1 = s1[i-1] + aligned1;
-            aligned2 = '-' + aligned2;
-            result.gaps++;
-            --i;
-        } else {
-            aligned1 = '-' + aligned1;
-            aligned2 = s2[j-1] + aligned2;
-            result.gaps++;
-            --j;
+
+            scoreAt(i, j) = best;
+            traceAt(i, j) = dir;
         }
     }
 
-    result.aligned_seq1 = std::move(aligned1);
-    result.aligned_seq2 = std::move(aligned2);
+    Alignment result = affineTracebackFrom(s1, s2, m, n, false);
+    result.score = scoreAt(m, n);
     result.start1 = 0;
     result.start2 = 0;
     result.end1 = m - 1;
     result.end2 = n - 1;
-
     return result;
 }
 
-// ============================================================================
-// Distance Functions
-// ============================================================================
-
-size_t editDistance(const Sequence& seq1, const Sequence& seq2) {
+Alignment Aligner::semiGlobalAlignment(const Sequence& seq1,
+                                       const Sequence& seq2) {
     const auto& s1 = seq1.bases();
     const auto& s2 = seq2.bases();
     const size_t m = s1.length();
     const size_t n = s2.length();
 
-    // Use space-optimized version with two rows
-    std::vector<size_t> prev(n + 1), curr(n + 1);
+    reserveMatrix(m + 1, n + 1);
 
-    // Initialize first row
-    for (size_t j = 0; j <= n; ++j) {
-        prev[j] = j;
+    // Gaps in seq1 are penalized; gaps at the ends of seq2 are free
+    scoreAt(0, 0) = 0;
+    traceAt(0, 0) = TraceDirection::None;
+    for (size_t i = 1; i <= m; ++i) {
+        scoreAt(i, 0) = static_cast<int>(i) * scoring_.gapPenalty();
+        traceAt(i, 0) = TraceDirection::Up;
+    }
+    for (size_t j = 1; j <= n; ++j) {
+        scoreAt(0, j) = 0;
+        traceAt(0, j) = TraceDirection::Left;
     }
 
     for (size_t i = 1; i <= m; ++i) {
-        curr[0] = i;
-
         for (size_t j = 1; j <= n; ++j) {
-            if (s1[i-1] == s2[j-1]) {
-                curr[j] = prev[j-1];
+            int match = scoreAt(i-1, j-1) + scoring_.score(s1[i-1], s2[j-1]);
+            int delete_gap = scoreAt(i-1, j) + scoring_.gapPenalty();
+            int insert_gap = scoreAt(i, j-1) + scoring_.gapPenalty();
+
+            int best;
+            TraceDirection dir;
+
+            if (match >= delete_gap && match >= insert_gap) {
+                best = match;
+                dir = TraceDirection::Diagonal;
+            } else if (delete_gap >= insert_gap) {
+                best = delete_gap;
+                dir = TraceDirection::Up;
             } else {
-                curr[j] = 1 + std::min({prev[j-1], prev[j], curr[j-1]});
+                best = insert_gap;
+                dir = TraceDirection::Left;
             }
-        }
 
-        std::swap(prev, curr);
+            scoreAt(i, j) = best;
+            traceAt(i, j) = dir;
+        }
     }
 
-    return prev[n];
-}
-
-size_t hammingDistance(const Sequence& seq1, const Sequence& seq2) {
-    if (seq1.length() != seq2.length()) {
-        throw AlignmentError("Hamming distance requires equal-length sequences");
+    // Best score in the last row (end gaps in seq2 are free)
+    int max_score = scoreAt(m, 0);
+    size_t max_j = 0;
+    for (size_t j = 1; j <= n; ++j) {
+        if (scoreAt(m, j) > max_score) {
+            max_score = scoreAt(m, j);
+            max_j = j;
+        }
     }
 
-    const auto& s1 = seq1.bases();
-    const auto& s2 = seq2.bases();
+    Alignment result = tracebackFrom(s1, s2, m, max_j, false);
 
-    size_t distance = 0;
-    for (size_t i = 0; i < s1.length(); ++i) {
-        if (s1[i] != s2[i]) {
-            ++distance;
-        }
+    // Trailing free gaps in seq2, if the alignment ends before its end
+    for (size_t k = max_j; k < n; ++k) {
+        result.aligned_seq1 += '-';
+        result.aligned_seq2 += s2[k];
+        result.gaps++;
     }
 
-    return distance;
+    result.score = max_score;
+    result.start1 = 0;
+    result.start2 = 0;
+    result.end1 = m - 1;
+    result.end2 = n - 1;
+    return result;
 }
 
 // ============================================================================
-// Banded Smith-Waterman
+// Banded Alignment
 // ============================================================================
 
-Alignment bandedSmithWaterman(
-    const Sequence& seq1,
-    const Sequence& seq2,
-    size_t bandwidth,
-    const ScoringMatrix& scoring
-) {
-    const auto& s1 = seq1.bases();
-    const auto& s2 = seq2.bases();
-    const size_t m = s1.length();
+Alignment Aligner::bandedTracebackFrom(std::string_view s1, std::string_view s2,
+                                       size_t i, size_t band_j,
+                                       std::ptrdiff_t diag_lo, bool affine) {
     const size_t n = s2.length();
+    const size_t edge = cols_ - 1;
 
-    // For sequences of very different lengths, fall back to regular SW
-    if (m > n + bandwidth || n > m + bandwidth) {
-        return smithWaterman(seq1, seq2, scoring);
+    Alignment result;
+    result.matches = 0;
+    result.mismatches = 0;
+    result.gaps = 0;
+
+    std::string aligned1, aligned2;
+
+    auto visit = [&](size_t row, size_t bj) {
+        // The band constrained this path if it runs along an edge with
+        // real matrix cells beyond it; that is the adaptive variants'
+        // cue to widen
+        size_t j = static_cast<size_t>(
+            static_cast<std::ptrdiff_t>(row + bj) + diag_lo);
+        if ((bj == 0 && j > 1) || (bj == edge && row > 1 && j < n)) {
+            band_edge_hit_ = true;
+        }
+    };
+
+    enum class State { Main, GapUp, GapLeft };
+    State state = State::Main;
+
+    while (true) {
+        size_t j = static_cast<size_t>(
+            static_cast<std::ptrdiff_t>(i + band_j) + diag_lo);
+
+        if (state == State::Main) {
+            if (i == 0 || j == 0 || score_[i * cols_ + band_j] <= 0) break;
+            visit(i, band_j);
+
+            TraceDirection dir = trace_[i * cols_ + band_j];
+            if (dir == TraceDirection::Diagonal) {
+                aligned1 += s1[i-1];
+                aligned2 += s2[j-1];
+                if (s1[i-1] == s2[j-1]) {
+                    result.matches++;
+                } else {
+                    result.mismatches++;
+                }
+                --i;  // diagonal keeps the band column
+            } else if (dir == TraceDirection::Up) {
+                if (affine) {
+                    state = State::GapUp;
+                } else {
+                    aligned1 += s1[i-1];
+                    aligned2 += '-';
+                    result.gaps++;
+                    --i;
+                    ++band_j;
+                }
+            } else if (dir == TraceDirection::Left) {
+                if (affine) {
+                    state = State::GapLeft;
+                } else {
+                    aligned1 += '-';
+                    aligned2 += s2[j-1];
+                    result.gaps++;
+                    --band_j;
+                }
+            } else {
+                break;
+            }
+        } else if (state == State::GapUp) {
+            visit(i, band_j);
+            aligned1 += s1[i-1];
+            aligned2 += '-';
+            result.gaps++;
+            bool extended = up_extend_[i * cols_ + band_j] != 0;
+            --i;
+            ++band_j;
+            if (!extended) state = State::Main;
+        } else {
+            visit(i, band_j);
+            aligned1 += '-';
+            aligned2 += s2[j-1];
+            result.gaps++;
+            bool extended = left_extend_[i * cols_ + band_j] != 0;
+            --band_j;
+            if (!extended) state = State::Main;
+        }
     }
 
-    const int k = static_cast<int>(bandwidth);
+    std::reverse(aligned1.begin(), aligned1.end());
+    std::reverse(aligned2.begin(), aligned2.end());
 
-    // Create banded scoring matrix
-    std::vector<std::vector<int>> score_matrix(m + 1,
-        std::vector<int>(2 * bandwidth + 1, 0));
-    std::vector<std::vector<TraceDirection>> trace(m + 1,
-        std::vector<TraceDirection>(2 * bandwidth + 1, TraceDirection::None));
+    result.aligned_seq1 = std::move(aligned1);
+    result.aligned_seq2 = std::move(aligned2);
+    result.start1 = i;
+    result.start2 = static_cast<size_t>(
+        static_cast<std::ptrdiff_t>(i + band_j) + diag_lo);
+
+    return result;
+}
+
+Alignment Aligner::bandedSmithWaterman(const Sequence& seq1,
+                                       const Sequence& seq2,
+                                       size_t bandwidth) {
+    const auto& s1 = seq1.bases();
+    const auto& s2 = seq2.bases();
+    const size_t m = s1.length();
+    const size_t n = s2.length();
+    bandwidth = std::max<size_t>(bandwidth, 1);
+
+    // Diagonals j - i within [min(0, n-m) - bandwidth,
+    // max(0, n-m) + bandwidth]: the length difference is part of the
+    // band, so offsets between unequal-length sequences (e.g. a read
+    // inside a padded reference window) stay reachable
+    const auto diff = static_cast<std::ptrdiff_t>(n) -
+                      static_cast<std::ptrdiff_t>(m);
+    const std::ptrdiff_t k = static_cast<std::ptrdiff_t>(bandwidth);
+    const std::ptrdiff_t diag_lo = std::min<std::ptrdiff_t>(diff, 0) - k;
+    const std::ptrdiff_t diag_hi = std::max<std::ptrdiff_t>(diff, 0) + k;
+    const size_t width = static_cast<size_t>(diag_hi - diag_lo) + 1;
+
+    reserveMatrix(m + 1, width);
+    band_edge_hit_ = false;
+
+    // Row 0 doubles as the virtual zero boundary of local alignment
+    std::fill_n(score_.begin(), width, 0);
+    std::fill_n(trace_.begin(), width, TraceDirection::None);
 
     int max_score = 0;
-    size_t max_i = 0, max_j = 0;
+    size_t max_i = 0;
+    size_t max_band_j = 0;
 
     for (size_t i = 1; i <= m; ++i) {
-        int j_start = std::max(1, static_cast<int>(i) - k);
-        int j_end = std::min(static_cast<int>(n), static_cast<int>(i) + k);
-
-        for (int j = j_start; j <= j_end; ++j) {
-            int band_j = j - static_cast<int>(i) + k;
-
-            int match = 0;
-            if (band_j >= 0 && band_j < static_cast<int>(2 * bandwidth + 1) &&
-                i > 0 && static_cast<size_t>(j) > 0) {
-                int prev_band_j = band_j;  // Same offset since both i and j decrease
-                if (prev_band_j >= 0 && prev_band_j < static_cast<int>(2 * bandwidth + 1)) {
-                    match = score_matrix[i-1][prev_band_j] +
-                            scoring.score(s1[i-1], s2[j-1]);
+        const auto row = static_cast<std::ptrdiff_t>(i);
+        const size_t j_start =
+            static_cast<size_t>(std::max<std::ptrdiff_t>(1, row + diag_lo));
+        if (j_start > n) break;  // the band has left the matrix
+        const size_t j_end = std::min(
+            n, static_cast<size_t>(std::max<std::ptrdiff_t>(0, row + diag_hi)));
+
+        // Out-of-range band cells must read as empty for row i+1
+        std::fill_n(score_.begin() + i * width, width, 0);
+        std::fill_n(trace_.begin() + i * width, width, TraceDirection::None);
+
+        for (size_t j = j_start; j <= j_end; ++j) {
+            const auto bj = static_cast<size_t>(
+                static_cast<std::ptrdiff_t>(j) - row - diag_lo);
+
+            int best = 0;
+            TraceDirection dir = TraceDirection::None;
+
+            // Diagonal neighbour sits at the same band column one row up
+            int match = scoreAt(i-1, bj) + scoring_.score(s1[i-1], s2[j-1]);
+            if (match > best) {
+                best = match;
+                dir = TraceDirection::Diagonal;
+            }
+            if (bj + 1 < width) {
+                int delete_gap = scoreAt(i-1, bj+1) + scoring_.gapPenalty();
+                if (delete_gap > best) {
+                    best = delete_gap;
+                    dir = TraceDirection::Up;
+                }
+            }
+            if (bj > 0) {
+                int insert_gap = scoreAt(i, bj-1) + scoring_.gapPenalty();
+                if (insert_gap > best) {
+                    best = insert_gap;
+                    dir = TraceDirection::Left;
                 }
             }
 
-            int delete_gap = 0;
-            int up_band_j = band_j + 1;  // j stays same, i decreases
-            if (up_band_j >= 0 && up_band_j < static_cast<int>(2 * bandwidth + 1)) {
-                delete_gap = score_matrix[i-1][up_band_j] + scoring.gapPenalty();
+            scoreAt(i, bj) = best;
+            traceAt(i, bj) = dir;
+
+            if (best > max_score) {
+                max_score = best;
+                max_i = i;
+                max_band_j = bj;
             }
+        }
+    }
+
+    if (max_score <= 0) {
+        return Alignment{"", "", 0, 0, 0, 0, 0, 0, 0, 0};
+    }
+
+    Alignment result =
+        bandedTracebackFrom(s1, s2, max_i, max_band_j, diag_lo, false);
+    result.score = max_score;
+    result.end1 = max_i - 1;
+    result.end2 = static_cast<size_t>(
+        static_cast<std::ptrdiff_t>(max_i + max_band_j) + diag_lo) - 1;
+    return result;
+}
+
+Alignment Aligner::bandedSmithWatermanAffine(const Sequence& seq1,
+                                             const Sequence& seq2,
+                                             size_t bandwidth) {
+    const auto& s1 = seq1.bases();
+    const auto& s2 = seq2.bases();
+    const size_t m = s1.length();
+    const size_t n = s2.length();
+    const int open = scoring_.gap_open_penalty;
+    const int extend = scoring_.gap_extend_penalty;
+    bandwidth = std::max<size_t>(bandwidth, 1);
+
+    // Same diagonal band as the linear variant
+    const auto diff = static_cast<std::ptrdiff_t>(n) -
+                      static_cast<std::ptrdiff_t>(m);
+    const std::ptrdiff_t k = static_cast<std::ptrdiff_t>(bandwidth);
+    const std::ptrdiff_t diag_lo = std::min<std::ptrdiff_t>(diff, 0) - k;
+    const std::ptrdiff_t diag_hi = std::max<std::ptrdiff_t>(diff, 0) + k;
+    const size_t width = static_cast<size_t>(diag_hi - diag_lo) + 1;
+
+    reserveAffineMatrix(m + 1, width);
+    band_edge_hit_ = false;
+
+    auto clearRow = [&](size_t i) {
+        std::fill_n(score_.begin() + i * width, width, 0);
+        std::fill_n(trace_.begin() + i * width, width, TraceDirection::None);
+        std::fill_n(up_score_.begin() + i * width, width, kAffineNegInf);
+        std::fill_n(left_score_.begin() + i * width, width, kAffineNegInf);
+        std::fill_n(up_extend_.begin() + i * width, width, uint8_t{0});
+        std::fill_n(left_extend_.begin() + i * width, width, uint8_t{0});
+    };
+    clearRow(0);
+
+    int max_score = 0;
+    size_t max_i = 0;
+    size_t max_band_j = 0;
 
-            int insert_gap = 0;
-            int left_band_j = band_j - 1;  // i stays same, j decreases
-            if (left_band_j >= 0 && left_band_j < static_cast<int>(2 * bandwidth + 1)) {
-                insert_gap = score_matrix[i][left_band_j] + scoring.gapPenalty();
+    for (size_t i = 1; i <= m; ++i) {
+        const auto row = static_cast<std::ptrdiff_t>(i);
+        const size_t j_start =
+            static_cast<size_t>(std::max<std::ptrdiff_t>(1, row + diag_lo));
+        if (j_start > n) break;
+        const size_t j_end = std::min(
+            n, static_cast<size_t>(std::max<std::ptrdiff_t>(0, row + diag_hi)));
+
+        clearRow(i);
+
+        for (size_t j = j_start; j <= j_end; ++j) {
+            const auto bj = static_cast<size_t>(
+                static_cast<std::ptrdiff_t>(j) - row - diag_lo);
+
+            int up = kAffineNegInf;
+            if (bj + 1 < width) {
+                int open_up = scoreAt(i-1, bj+1) + open;
+                int extend_up = upAt(i-1, bj+1) + extend;
+                up = std::max(open_up, extend_up);
+                up_extend_[i * cols_ + bj] = extend_up > open_up ? 1 : 0;
+            }
+            upAt(i, bj) = up;
+
+            int left = kAffineNegInf;
+            if (bj > 0) {
+                int open_left = scoreAt(i, bj-1) + open;
+                int extend_left = leftAt(i, bj-1) + extend;
+                left = std::max(open_left, extend_left);
+                left_extend_[i * cols_ + bj] = extend_left > open_left ? 1 : 0;
             }
+            leftAt(i, bj) = left;
+
+            int match = scoreAt(i-1, bj) + scoring_.score(s1[i-1], s2[j-1]);
 
             int best = 0;
             TraceDirection dir = TraceDirection::None;
-
             if (match > best) {
                 best = match;
                 dir = TraceDirection::Diagonal;
             }
-            if (delete_gap > best) {
-                best = delete_gap;
+            if (up > best) {
+                best = up;
                 dir = TraceDirection::Up;
             }
-            if (insert_gap > best) {
-                best = insert_gap;
+            if (left > best) {
+                best = left;
                 dir = TraceDirection::Left;
             }
 
-            score_matrix[i][band_j] = best;
-            trace[i][band_j] = dir;
+            scoreAt(i, bj) = best;
+            traceAt(i, bj) = dir;
 
             if (best > max_score) {
                 max_score = best;
                 max_i = i;
-                max_j = static_cast<size_t>(j);
+                max_band_j = bj;
             }
         }
     }
 
-    // Simplified traceback - fall back to standard SW for actual traceback
-    // This is a common optimization pattern
-    return smithWaterman(seq1, seq2, scoring);
+    if (max_score <= 0) {
+        return Alignment{"", "", 0, 0, 0, 0, 0, 0, 0, 0};
+    }
+
+    Alignment result =
+        bandedTracebackFrom(s1, s2, max_i, max_band_j, diag_lo, true);
+    result.score = max_score;
+    result.end1 = max_i - 1;
+    result.end2 = static_cast<size_t>(
+        static_cast<std::ptrdiff_t>(max_i + max_band_j) + diag_lo) - 1;
+    return result;
+}
+
+Alignment Aligner::adaptiveBandedSmithWaterman(const Sequence& seq1,
+                                               const Sequence& seq2,
+                                               size_t initial_bandwidth) {
+    size_t bandwidth = std::max<size_t>(initial_bandwidth, 1);
+    const size_t full = std::max(seq1.length(), seq2.length());
+
+    // A truncated local optimum can sit well inside the band, so edge
+    // contact alone is not a safe stopping rule; additionally require the
+    // score to be stable across a doubling of the band.
+    Alignment result = bandedSmithWaterman(seq1, seq2, bandwidth);
+    bool edge_hit = band_edge_hit_;
+    while (bandwidth < full) {
+        bandwidth *= 2;
+        Alignment wider = bandedSmithWaterman(seq1, seq2, bandwidth);
+        if (wider.score == result.score && !edge_hit && !band_edge_hit_) {
+            return result;
+        }
+        edge_hit = band_edge_hit_;
+        result = std::move(wider);
+    }
+    return result;
+}
+
+Alignment Aligner::adaptiveBandedSmithWatermanAffine(const Sequence& seq1,
+                                                     const Sequence& seq2,
+                                                     size_t initial_bandwidth) {
+    size_t bandwidth = std::max<size_t>(initial_bandwidth, 1);
+    const size_t full = std::max(seq1.length(), seq2.length());
+
+    Alignment result = bandedSmithWatermanAffine(seq1, seq2, bandwidth);
+    bool edge_hit = band_edge_hit_;
+    while (bandwidth < full) {
+        bandwidth *= 2;
+        Alignment wider = bandedSmithWatermanAffine(seq1, seq2, bandwidth);
+        if (wider.score == result.score && !edge_hit && !band_edge_hit_) {
+            return result;
+        }
+        edge_hit = band_edge_hit_;
+        result = std::move(wider);
+    }
+    return result;
 }
 
 // ============================================================================
-// Multiple Sequence Alignment
+// Smith-Waterman Algorithm
 // ============================================================================
 
-std::vector<std::string> multipleAlignment(
-    const std::vector<Sequence>& sequences,
+Alignment smithWaterman(
+    const Sequence& seq1,
+    const Sequence& seq2,
     const ScoringMatrix& scoring
 ) {
-    if (sequences.empty()) {
-        return {};
+    thread_local Aligner aligner;
+    aligner.setScoring(scoring);
+    return aligner.smithWaterman(seq1, seq2);
+}
+
+Alignment smithWatermanAffine(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    const ScoringMatrix& scoring
+) {
+    thread_local Aligner aligner;
+    aligner.setScoring(scoring);
+    return aligner.smithWatermanAffine(seq1, seq2);
+}
+
+Alignment needlemanWunschAffine(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    const ScoringMatrix& scoring
+) {
+    thread_local Aligner aligner;
+    aligner.setScoring(scoring);
+    return aligner.needlemanWunschAffine(seq1, seq2);
+}
+
+// ============================================================================
+// Striped Smith-Waterman (Farrar)
+// ============================================================================
+
+#if defined(__SSE2__)
+
+namespace {
+
+// A/C/G/T/other, used to index the striped query profile
+constexpr size_t kAlphabetSize = 5;
+
+size_t symbolIndex(char c) noexcept {
+    switch (c) {
+        case 'A': return 0;
+        case 'C': return 1;
+        case 'G': return 2;
+        case 'T': return 3;
+        default:  return 4;
     }
-    if (sequences.size() == 1) {
-        return {sequences[0].bases()};
+}
+
+struct StripedScore {
+    int score = 0;
+    size_t target_end = 0;  // 0-based index into the target
+    bool saturated = false;
+};
+
+// std::vector<__m128i> drops the vector type's alignment attribute when
+// it is used as an allocator template argument (-Wignored-attributes),
+// so the striped buffers hold this over-aligned POD wrapper instead
+struct alignas(16) Vec128 {
+    __m128i v;
+};
+
+// 8-bit saturating pass. Scores are biased into unsigned lanes; the
+// saturating subtract doubles as the local-alignment floor at zero.
+// Linear gap model (open == extend), matching the scalar DP.
+StripedScore stripedScoreByte(std::string_view query,
+                              std::string_view target,
+                              const ScoringMatrix& scoring) {
+    constexpr size_t lanes = 16;
+    const size_t seg_len = (query.length() + lanes - 1) / lanes;
+
+    const int bias = std::max(0, -scoring.mismatch_penalty);
+    const auto gap = static_cast<uint8_t>(-scoring.gapPenalty());
+
+    // Striped profile: lane l, segment i covers query position
+    // l * seg_len + i; padding lanes get weight 0 and decay with the bias
+    std::vector<Vec128> profile(kAlphabetSize * seg_len);
+    {
+        auto* bytes = reinterpret_cast<uint8_t*>(profile.data());
+        for (size_t sym = 0; sym < kAlphabetSize; ++sym) {
+            for (size_t i = 0; i < seg_len; ++i) {
+                for (size_t l = 0; l < lanes; ++l) {
+                    size_t q = l * seg_len + i;
+                    int w = q < query.length()
+                        ? scoring.score("ACGTN"[sym], query[q]) + bias
+                        : 0;
+                    bytes[(sym * seg_len + i) * lanes + l] =
+                        static_cast<uint8_t>(w);
+                }
+            }
+        }
     }
 
-    // Progressive alignment: align sequences pairwise and build consensus
-    std::vector<std::string> aligned;
-    aligned.push_back(sequences[0].bases());
-
-    for (size_t i = 1; i < sequences.size(); ++i) {
-        // Create temporary sequence from consensus of aligned sequences
-        // For simplicity, use the first aligned sequence
-        Sequence consensus(aligned[0]);
-        auto pairwise = needlemanWunsch(consensus, sequences[i], scoring);
-
-        // Update all previously aligned sequences with new gaps
-        std::vector<std::string> new_aligned;
-        for (const auto& seq : aligned) {
-            std::string updated;
-            size_t seq_pos = 0;
-            for (char c : pairwise.aligned_seq1) {
-                if (c == '-') {
-                    updated += '-';
-                } else {
-                    updated += (seq_pos < seq.length()) ? seq[seq_pos++] : '-';
+    std::vector<Vec128> h_store(seg_len, Vec128{_mm_setzero_si128()});
+    std::vector<Vec128> h_load(seg_len, Vec128{_mm_setzero_si128()});
+    std::vector<Vec128> e_vec(seg_len, Vec128{_mm_setzero_si128()});
+
+    const __m128i v_bias = _mm_set1_epi8(static_cast<char>(bias));
+    const __m128i v_gap = _mm_set1_epi8(static_cast<char>(gap));
+    const __m128i v_zero = _mm_setzero_si128();
+
+    StripedScore result;
+
+    for (size_t j = 0; j < target.length(); ++j) {
+        const Vec128* prof = &profile[symbolIndex(target[j]) * seg_len];
+
+        // H(0, j) enters segment 0 shifted up one lane from the last
+        // segment of the previous column
+        __m128i v_h = _mm_slli_si128(h_store[seg_len - 1].v, 1);
+        __m128i v_f = v_zero;
+
+        std::swap(h_store, h_load);
+
+        for (size_t i = 0; i < seg_len; ++i) {
+            v_h = _mm_subs_epu8(_mm_adds_epu8(v_h, prof[i].v), v_bias);
+
+            __m128i v_e = e_vec[i].v;
+            v_h = _mm_max_epu8(v_h, v_e);
+            v_h = _mm_max_epu8(v_h, v_f);
+            h_store[i].v = v_h;
+
+            __m128i v_h_gap = _mm_subs_epu8(v_h, v_gap);
+            v_e = _mm_subs_epu8(v_e, v_gap);
+            v_e = _mm_max_epu8(v_e, v_h_gap);
+            e_vec[i].v = v_e;
+
+            v_f = _mm_subs_epu8(v_f, v_gap);
+            v_f = _mm_max_epu8(v_f, v_h_gap);
+
+            v_h = h_load[i].v;
+        }
+
+        // Lazy F: propagate gap openings that cross segment boundaries,
+        // stopping as soon as F is dominated in every lane
+        bool f_done = false;
+        for (size_t l = 0; l < lanes && !f_done; ++l) {
+            v_f = _mm_slli_si128(v_f, 1);
+            for (size_t i = 0; i < seg_len; ++i) {
+                v_h = _mm_max_epu8(h_store[i].v, v_f);
+                h_store[i].v = v_h;
+                v_h = _mm_subs_epu8(v_h, v_gap);
+                v_f = _mm_subs_epu8(v_f, v_gap);
+                __m128i v_cmp = _mm_cmpeq_epi8(
+                    _mm_subs_epu8(v_f, v_h), v_zero);
+                if (_mm_movemask_epi8(v_cmp) == 0xFFFF) {
+                    f_done = true;
+                    break;
+                }
+            }
+        }
+
+        // Column maximum (unsigned horizontal max-reduce)
+        __m128i v_col = v_zero;
+        for (size_t i = 0; i < seg_len; ++i) {
+            v_col = _mm_max_epu8(v_col, h_store[i].v);
+        }
+        v_col = _mm_max_epu8(v_col, _mm_srli_si128(v_col, 8));
+        v_col = _mm_max_epu8(v_col, _mm_srli_si128(v_col, 4));
+        v_col = _mm_max_epu8(v_col, _mm_srli_si128(v_col, 2));
+        v_col = _mm_max_epu8(v_col, _mm_srli_si128(v_col, 1));
+        int col_max = _mm_cvtsi128_si32(v_col) & 0xFF;
+
+        if (col_max > result.score) {
+            result.score = col_max;
+            result.target_end = j;
+        }
+    }
+
+    // Biased lanes clamp at 255, so scores plateau at 255 - bias
+    result.saturated = result.score + bias >= 255;
+    return result;
+}
+
+// 16-bit signed pass for alignments whose score overflows 8 bits
+StripedScore stripedScoreWord(std::string_view query,
+                              std::string_view target,
+                              const ScoringMatrix& scoring) {
+    constexpr size_t lanes = 8;
+    const size_t seg_len = (query.length() + lanes - 1) / lanes;
+
+    const auto gap = static_cast<int16_t>(-scoring.gapPenalty());
+
+    std::vector<Vec128> profile(kAlphabetSize * seg_len);
+    {
+        auto* words = reinterpret_cast<int16_t*>(profile.data());
+        for (size_t sym = 0; sym < kAlphabetSize; ++sym) {
+            for (size_t i = 0; i < seg_len; ++i) {
+                for (size_t l = 0; l < lanes; ++l) {
+                    size_t q = l * seg_len + i;
+                    words[(sym * seg_len + i) * lanes + l] =
+                        q < query.length()
+                            ? static_cast<int16_t>(
+                                  scoring.score("ACGTN"[sym], query[q]))
+                            : int16_t{0};
+                }
+            }
+        }
+    }
+
+    std::vector<Vec128> h_store(seg_len, Vec128{_mm_setzero_si128()});
+    std::vector<Vec128> h_load(seg_len, Vec128{_mm_setzero_si128()});
+    std::vector<Vec128> e_vec(seg_len, Vec128{_mm_setzero_si128()});
+
+    const __m128i v_gap = _mm_set1_epi16(gap);
+    const __m128i v_zero = _mm_setzero_si128();
+
+    StripedScore result;
+
+    for (size_t j = 0; j < target.length(); ++j) {
+        const Vec128* prof = &profile[symbolIndex(target[j]) * seg_len];
+
+        __m128i v_h = _mm_slli_si128(h_store[seg_len - 1].v, 2);
+        __m128i v_f = v_zero;
+
+        std::swap(h_store, h_load);
+
+        for (size_t i = 0; i < seg_len; ++i) {
+            v_h = _mm_adds_epi16(v_h, prof[i].v);
+
+            __m128i v_e = e_vec[i].v;
+            v_h = _mm_max_epi16(v_h, v_e);
+            v_h = _mm_max_epi16(v_h, v_f);
+            v_h = _mm_max_epi16(v_h, v_zero);
+            h_store[i].v = v_h;
+
+            __m128i v_h_gap = _mm_subs_epi16(v_h, v_gap);
+            v_e = _mm_subs_epi16(v_e, v_gap);
+            v_e = _mm_max_epi16(v_e, v_h_gap);
+            e_vec[i].v = v_e;
+
+            v_f = _mm_subs_epi16(v_f, v_gap);
+            v_f = _mm_max_epi16(v_f, v_h_gap);
+
+            v_h = h_load[i].v;
+        }
+
+        bool f_done = false;
+        for (size_t l = 0; l < lanes && !f_done; ++l) {
+            v_f = _mm_slli_si128(v_f, 2);
+            for (size_t i = 0; i < seg_len; ++i) {
+                v_h = _mm_max_epi16(h_store[i].v, v_f);
+                h_store[i].v = v_h;
+                v_h = _mm_subs_epi16(v_h, v_gap);
+                v_f = _mm_subs_epi16(v_f, v_gap);
+                if (_mm_movemask_epi8(_mm_cmpgt_epi16(v_f, v_h)) == 0) {
+                    f_done = true;
+                    break;
                 }
             }
-            new_aligned.push_back(std::move(updated));
         }
 
-        // Add newly aligned sequence
-        new_aligned.push_back(pairwise.aligned_seq2);
-        aligned = std::move(new_aligned);
+        __m128i v_col = v_zero;
+        for (size_t i = 0; i < seg_len; ++i) {
+            v_col = _mm_max_epi16(v_col, h_store[i].v);
+        }
+        v_col = _mm_max_epi16(v_col, _mm_srli_si128(v_col, 8));
+        v_col = _mm_max_epi16(v_col, _mm_srli_si128(v_col, 4));
+        v_col = _mm_max_epi16(v_col, _mm_srli_si128(v_col, 2));
+        int col_max = static_cast<int16_t>(_mm_extract_epi16(v_col, 0));
+
+        if (col_max > result.score) {
+            result.score = col_max;
+            result.target_end = j;
+        }
+    }
+
+    result.saturated =
+        result.score >= std::numeric_limits<int16_t>::max();
+    return result;
+}
+
+StripedScore stripedScore(std::string_view query,
+                          std::string_view target,
+                          const ScoringMatrix& scoring) {
+    auto result = stripedScoreByte(query, target, scoring);
+    if (result.saturated) {
+        result = stripedScoreWord(query, target, scoring);
+    }
+    return result;
+}
+
+} // namespace
+
+Alignment smithWatermanSIMD(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    const ScoringMatrix& scoring
+) {
+    const auto& s1 = seq1.bases();
+    const auto& s2 = seq2.bases();
+
+    // Forward score pass finds the best score and where it ends in seq2
+    auto forward = stripedScore(s1, s2, scoring);
+    if (forward.score == 0 || forward.saturated) {
+        // Nothing aligned, or the score overflowed even 16-bit lanes;
+        // the scalar path handles both
+        return smithWaterman(seq1, seq2, scoring);
+    }
+
+    // Reverse pass over the prefix locates where the alignment starts
+    std::string rev_query(s1.rbegin(), s1.rend());
+    std::string rev_target(s2.rend() - (forward.target_end + 1), s2.rend());
+    auto reverse = stripedScore(rev_query, rev_target, scoring);
+
+    size_t start2 = forward.target_end - reverse.target_end;
+    size_t window = forward.target_end - start2 + 1;
+
+    // Scalar traceback restricted to the window the score passes found
+    auto result = smithWaterman(seq1, seq2.subsequence(start2, window),
+                                scoring);
+    result.start2 += start2;
+    result.end2 += start2;
+    return result;
+}
+
+#else  // !defined(__SSE2__)
+
+Alignment smithWatermanSIMD(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    const ScoringMatrix& scoring
+) {
+    return smithWaterman(seq1, seq2, scoring);
+}
+
+#endif
+
+// ============================================================================
+// Needleman-Wunsch Algorithm
+// ============================================================================
+
+namespace {
+
+// Full DP above this many cells would need hundreds of megabytes of
+// score + traceback arena, so needlemanWunsch() switches to the
+// linear-space Hirschberg mode instead
+constexpr size_t kMaxDirectCells =
+    (size_t{64} << 20) / (sizeof(int) + sizeof(TraceDirection));
+
+// Last row of the global alignment score matrix for s1 vs s2, computed
+// with two rolling rows in O(|s2|) space
+std::vector<int> nwScoreLastRow(std::string_view s1, std::string_view s2,
+                                const ScoringMatrix& scoring) {
+    const size_t n = s2.length();
+    std::vector<int> prev(n + 1);
+    std::vector<int> curr(n + 1);
+
+    for (size_t j = 0; j <= n; ++j) {
+        prev[j] = static_cast<int>(j) * scoring.gapPenalty();
+    }
+
+    for (size_t i = 1; i <= s1.length(); ++i) {
+        curr[0] = static_cast<int>(i) * scoring.gapPenalty();
+        for (size_t j = 1; j <= n; ++j) {
+            int match = prev[j-1] + scoring.score(s1[i-1], s2[j-1]);
+            int delete_gap = prev[j] + scoring.gapPenalty();
+            int insert_gap = curr[j-1] + scoring.gapPenalty();
+            curr[j] = std::max({match, delete_gap, insert_gap});
+        }
+        std::swap(prev, curr);
+    }
+
+    return prev;
+}
+
+// Hirschberg divide-and-conquer: split s1 at its midpoint, find the
+// optimal split point in s2 from forward and reverse score rows, and
+// recurse; single-row subproblems fall through to the full DP
+void hirschbergAlign(std::string_view s1, std::string_view s2,
+                     const ScoringMatrix& scoring, Aligner& base_aligner,
+                     std::string& aligned1, std::string& aligned2) {
+    const size_t m = s1.length();
+    const size_t n = s2.length();
+
+    if (m == 0) {
+        aligned1.append(n, '-');
+        aligned2.append(s2);
+        return;
+    }
+    if (n == 0) {
+        aligned1.append(s1);
+        aligned2.append(m, '-');
+        return;
+    }
+    if (m == 1 || n == 1) {
+        auto sub = base_aligner.needlemanWunsch(
+            makeSequenceUnchecked(std::string(s1)),
+            makeSequenceUnchecked(std::string(s2))
+        );
+        aligned1 += sub.aligned_seq1;
+        aligned2 += sub.aligned_seq2;
+        return;
+    }
+
+    const size_t mid = m / 2;
+
+    auto forward = nwScoreLastRow(s1.substr(0, mid), s2, scoring);
+
+    std::string rev1(s1.rbegin(), s1.rend() - static_cast<ptrdiff_t>(mid));
+    std::string rev2(s2.rbegin(), s2.rend());
+    auto reverse = nwScoreLastRow(rev1, rev2, scoring);
+
+    size_t split = 0;
+    int best = std::numeric_limits<int>::min();
+    for (size_t j = 0; j <= n; ++j) {
+        int total = forward[j] + reverse[n - j];
+        if (total > best) {
+            best = total;
+            split = j;
+        }
     }
 
-    return aligned;
+    hirschbergAlign(s1.substr(0, mid), s2.substr(0, split),
+                    scoring, base_aligner, aligned1, aligned2);
+    hirschbergAlign(s1.substr(mid), s2.substr(split),
+                    scoring, base_aligner, aligned1, aligned2);
+}
+
+} // anonymous namespace
+
+Alignment needlemanWunschLinear(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    const ScoringMatrix& scoring
+) {
+    const auto& s1 = seq1.bases();
+    const auto& s2 = seq2.bases();
+
+    Aligner base_aligner(scoring);
+    std::string aligned1, aligned2;
+    aligned1.reserve(s1.length() + s2.length());
+    aligned2.reserve(s1.length() + s2.length());
+    hirschbergAlign(s1, s2, scoring, base_aligner, aligned1, aligned2);
+
+    // Recover score and statistics from the reconstructed alignment
+    Alignment result;
+    result.score = 0;
+    result.matches = 0;
+    result.mismatches = 0;
+    result.gaps = 0;
+
+    for (size_t i = 0; i < aligned1.length(); ++i) {
+        if (aligned1[i] == '-' || aligned2[i] == '-') {
+            result.score += scoring.gapPenalty();
+            result.gaps++;
+        } else {
+            result.score += scoring.score(aligned1[i], aligned2[i]);
+            if (aligned1[i] == aligned2[i]) {
+                result.matches++;
+            } else {
+                result.mismatches++;
+            }
+        }
+    }
+
+    result.aligned_seq1 = std::move(aligned1);
+    result.aligned_seq2 = std::move(aligned2);
+    result.start1 = 0;
+    result.start2 = 0;
+    result.end1 = s1.length() - 1;
+    result.end2 = s2.length() - 1;
+    return result;
+}
+
+Alignment needlemanWunsch(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    const ScoringMatrix& scoring
+) {
+    const size_t cells = (seq1.length() + 1) * (seq2.length() + 1);
+    if (cells > kMaxDirectCells) {
+        return needlemanWunschLinear(seq1, seq2, scoring);
+    }
+
+    thread_local Aligner aligner;
+    aligner.setScoring(scoring);
+    return aligner.needlemanWunsch(seq1, seq2);
+}
+
+// ============================================================================
+// Semi-Global Alignment
+// ============================================================================
+
+Alignment semiGlobalAlignment(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    const ScoringMatrix& scoring
+) {
+    thread_local Aligner aligner;
+    aligner.setScoring(scoring);
+    return aligner.semiGlobalAlignment(seq1, seq2);
+}
+
+// ============================================================================
+// BatchAligner Implementation
+// ============================================================================
+
+BatchAligner::BatchAligner(ScoringMatrix scoring, size_t num_threads)
+    : scoring_(scoring),
+      num_threads_(num_threads != 0
+                       ? num_threads
+                       : std::max<size_t>(1, std::thread::hardware_concurrency())) {}
+
+std::vector<Alignment> BatchAligner::alignAll(
+    std::span<const std::pair<Sequence, Sequence>> pairs,
+    AlignmentMode mode) const {
+    std::vector<Alignment> results(pairs.size());
+    if (pairs.empty()) {
+        return results;
+    }
+
+    auto alignOne = [&](Aligner& aligner, size_t index) {
+        const auto& [first, second] = pairs[index];
+        switch (mode) {
+            case AlignmentMode::Local:
+                results[index] = aligner.smithWaterman(first, second);
+                break;
+            case AlignmentMode::Global:
+                results[index] = aligner.needlemanWunsch(first, second);
+                break;
+            case AlignmentMode::SemiGlobal:
+                results[index] = aligner.semiGlobalAlignment(first, second);
+                break;
+        }
+    };
+
+    const size_t num_workers = std::min(num_threads_, pairs.size());
+    if (num_workers <= 1) {
+        Aligner aligner(scoring_);
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            alignOne(aligner, i);
+        }
+        return results;
+    }
+
+    // One deque per worker: owners pop from the front, idle workers
+    // steal from the back of a victim, so a run of huge alignments in
+    // one deque drains across all cores instead of pinning its owner
+    struct WorkQueue {
+        std::deque<size_t> indices;
+        std::mutex mutex;
+    };
+    std::vector<WorkQueue> queues(num_workers);
+    for (size_t i = 0; i < pairs.size(); ++i) {
+        queues[i % num_workers].indices.push_back(i);
+    }
+
+    std::exception_ptr first_error;
+    std::mutex error_mutex;
+
+    auto worker = [&](size_t self) {
+        Aligner aligner(scoring_);
+        try {
+            while (true) {
+                size_t index = 0;
+                bool found = false;
+
+                {
+                    std::lock_guard lock(queues[self].mutex);
+                    if (!queues[self].indices.empty()) {
+                        index = queues[self].indices.front();
+                        queues[self].indices.pop_front();
+                        found = true;
+                    }
+                }
+
+                // No tasks are ever re-queued, so an empty sweep over
+                // every victim means this worker is done
+                for (size_t v = 1; v < num_workers && !found; ++v) {
+                    WorkQueue& victim = queues[(self + v) % num_workers];
+                    std::lock_guard lock(victim.mutex);
+                    if (!victim.indices.empty()) {
+                        index = victim.indices.back();
+                        victim.indices.pop_back();
+                        found = true;
+                    }
+                }
+
+                if (!found) {
+                    return;
+                }
+                alignOne(aligner, index);
+            }
+        } catch (...) {
+            std::lock_guard lock(error_mutex);
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_workers);
+    for (size_t t = 0; t < num_workers; ++t) {
+        threads.emplace_back(worker, t);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+    return results;
+}
+
+// ============================================================================
+// Distance Functions
+// ============================================================================
+
+namespace {
+
+/// Myers' bit-parallel edit distance: the whole DP column for a pattern
+/// of <= 64 bases lives in one machine word, updated with a handful of
+/// bit operations per text character (Hyyro's formulation)
+size_t myersEditDistance(std::string_view pattern, std::string_view text) {
+    const size_t m = pattern.size();
+
+    std::array<uint64_t, 256> match_masks{};
+    for (size_t i = 0; i < m; ++i) {
+        match_masks[static_cast<unsigned char>(pattern[i])] |= uint64_t{1} << i;
+    }
+
+    uint64_t vp = (m == 64) ? ~uint64_t{0} : (uint64_t{1} << m) - 1;
+    uint64_t vn = 0;
+    const uint64_t high_bit = uint64_t{1} << (m - 1);
+    size_t score = m;
+
+    for (char c : text) {
+        const uint64_t eq = match_masks[static_cast<unsigned char>(c)];
+        const uint64_t d0 = (((eq & vp) + vp) ^ vp) | eq | vn;
+        uint64_t hp = vn | ~(d0 | vp);
+        const uint64_t hn = vp & d0;
+
+        if (hp & high_bit) {
+            ++score;
+        } else if (hn & high_bit) {
+            --score;
+        }
+
+        hp = (hp << 1) | 1;
+        vp = (hn << 1) | ~(d0 | hp);
+        vn = hp & d0;
+    }
+
+    return score;
+}
+
+size_t rowDpEditDistance(std::string_view s1, std::string_view s2) {
+    const size_t m = s1.length();
+    const size_t n = s2.length();
+    BIOFLOW_COUNT(dp_cells_filled, (m + 1) * (n + 1));
+
+    // Space-optimized version with two rows
+    std::vector<size_t> prev(n + 1), curr(n + 1);
+
+    for (size_t j = 0; j <= n; ++j) {
+        prev[j] = j;
+    }
+
+    for (size_t i = 1; i <= m; ++i) {
+        curr[0] = i;
+
+        for (size_t j = 1; j <= n; ++j) {
+            if (s1[i-1] == s2[j-1]) {
+                curr[j] = prev[j-1];
+            } else {
+                curr[j] = 1 + std::min({prev[j-1], prev[j], curr[j-1]});
+            }
+        }
+
+        std::swap(prev, curr);
+    }
+
+    return prev[n];
+}
+
+} // anonymous namespace
+
+size_t editDistance(const Sequence& seq1, const Sequence& seq2) {
+    std::string_view s1 = seq1.bases();
+    std::string_view s2 = seq2.bases();
+    if (s1.length() > s2.length()) {
+        std::swap(s1, s2);
+    }
+    if (s1.empty()) {
+        return s2.length();
+    }
+    if (s1.length() <= 64) {
+        return myersEditDistance(s1, s2);
+    }
+    return rowDpEditDistance(s1, s2);
+}
+
+std::optional<size_t> editDistanceWithin(const Sequence& seq1,
+                                         const Sequence& seq2,
+                                         size_t max_dist) {
+    std::string_view s1 = seq1.bases();
+    std::string_view s2 = seq2.bases();
+    if (s1.length() > s2.length()) {
+        std::swap(s1, s2);
+    }
+    const size_t m = s1.length();
+    const size_t n = s2.length();
+
+    // The length difference is an unconditional lower bound
+    if (n - m > max_dist) {
+        return std::nullopt;
+    }
+    if (m == 0) {
+        return n;
+    }
+
+    // Ukkonen band: cell d of a row holds D[i][i + d - max_dist], so the
+    // diagonal neighbour keeps its slot from row to row
+    constexpr size_t kUnreachable = std::numeric_limits<size_t>::max() / 2;
+    const size_t width = 2 * max_dist + 1;
+    std::vector<size_t> prev(width, kUnreachable), curr(width, kUnreachable);
+
+    for (size_t d = max_dist; d < width && d - max_dist <= n; ++d) {
+        prev[d] = d - max_dist;
+    }
+
+    for (size_t i = 1; i <= m; ++i) {
+        size_t row_min = kUnreachable;
+        for (size_t d = 0; d < width; ++d) {
+            // j = i + d - max_dist, skipping cells outside the matrix
+            if (i + d < max_dist) {
+                curr[d] = kUnreachable;
+                continue;
+            }
+            const size_t j = i + d - max_dist;
+            if (j > n) {
+                curr[d] = kUnreachable;
+                continue;
+            }
+            if (j == 0) {
+                curr[d] = i;
+            } else {
+                const size_t cost = (s1[i - 1] == s2[j - 1]) ? 0 : 1;
+                size_t best = prev[d] + cost;
+                if (d + 1 < width) {
+                    best = std::min(best, prev[d + 1] + 1);
+                }
+                if (d > 0) {
+                    best = std::min(best, curr[d - 1] + 1);
+                }
+                curr[d] = best;
+            }
+            row_min = std::min(row_min, curr[d]);
+        }
+        if (row_min > max_dist) {
+            return std::nullopt;
+        }
+        std::swap(prev, curr);
+    }
+
+    const size_t final_slot = n - m + max_dist;
+    const size_t distance = prev[final_slot];
+    if (distance > max_dist) {
+        return std::nullopt;
+    }
+    return distance;
+}
+
+size_t hammingDistance(const Sequence& seq1, const Sequence& seq2) {
+    if (seq1.length() != seq2.length()) {
+        throw AlignmentError("Hamming distance requires equal-length sequences");
+    }
+
+    const auto& s1 = seq1.bases();
+    const auto& s2 = seq2.bases();
+    const size_t length = s1.length();
+
+    size_t distance = 0;
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    for (; i + 16 <= length; i += 16) {
+        __m128i block1 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(s1.data() + i));
+        __m128i block2 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(s2.data() + i));
+        const unsigned equal_mask = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(block1, block2)));
+        distance += 16 - std::popcount(equal_mask & 0xFFFFu);
+    }
+#endif
+
+    for (; i < length; ++i) {
+        if (s1[i] != s2[i]) {
+            ++distance;
+        }
+    }
+
+    return distance;
+}
+
+// ============================================================================
+// Banded Smith-Waterman
+// ============================================================================
+
+Alignment bandedSmithWaterman(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    size_t bandwidth,
+    const ScoringMatrix& scoring
+) {
+    thread_local Aligner aligner;
+    aligner.setScoring(scoring);
+    return aligner.bandedSmithWaterman(seq1, seq2, bandwidth);
+}
+
+Alignment bandedSmithWatermanAffine(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    size_t bandwidth,
+    const ScoringMatrix& scoring
+) {
+    thread_local Aligner aligner;
+    aligner.setScoring(scoring);
+    return aligner.bandedSmithWatermanAffine(seq1, seq2, bandwidth);
+}
+
+Alignment adaptiveBandedSmithWaterman(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    size_t initial_bandwidth,
+    const ScoringMatrix& scoring
+) {
+    thread_local Aligner aligner;
+    aligner.setScoring(scoring);
+    return aligner.adaptiveBandedSmithWaterman(seq1, seq2, initial_bandwidth);
+}
+
+Alignment adaptiveBandedSmithWatermanAffine(
+    const Sequence& seq1,
+    const Sequence& seq2,
+    size_t initial_bandwidth,
+    const ScoringMatrix& scoring
+) {
+    thread_local Aligner aligner;
+    aligner.setScoring(scoring);
+    return aligner.adaptiveBandedSmithWatermanAffine(seq1, seq2, initial_bandwidth);
+}
+
+// ============================================================================
+// Multiple Sequence Alignment
+// ============================================================================
+
+namespace {
+
+/// K-mer length for the guide-tree distance matrix
+constexpr size_t kGuideKmerLength = 8;
+
+/// Run fn(i) for every i in [0, count) across num_workers fork-join threads
+template <typename Fn>
+void parallelFor(size_t count, size_t num_workers, Fn&& fn) {
+    num_workers = std::min(num_workers, count);
+    if (num_workers <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> cursor{0};
+    std::exception_ptr first_error;
+    std::mutex error_mutex;
+
+    auto worker = [&] {
+        try {
+            while (true) {
+                size_t index = cursor.fetch_add(1);
+                if (index >= count) {
+                    return;
+                }
+                fn(index);
+            }
+        } catch (...) {
+            std::lock_guard lock(error_mutex);
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_workers);
+    for (size_t t = 0; t < num_workers; ++t) {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+/// Binary guide-tree node; children index into the node array, leaves first
+struct GuideNode {
+    int left = -1;        // child node index, -1 for leaves
+    int right = -1;
+    size_t leaf = 0;      // sequence index when this node is a leaf
+    size_t leaves = 1;    // number of sequences below this node
+    size_t height = 0;    // longest path down to a leaf
+};
+
+/// All-vs-all 1 - Jaccard distances over k-mer profiles
+std::vector<double> kmerDistanceMatrix(const std::vector<Sequence>& sequences,
+                                       size_t num_workers) {
+    const size_t n = sequences.size();
+
+    std::vector<std::optional<KMerProfile>> profiles(n);
+    parallelFor(n, num_workers, [&](size_t i) {
+        const size_t k = std::max<size_t>(
+            1, std::min(kGuideKmerLength, sequences[i].length()));
+        EncodedKMerCounter counter(k);
+        counter.countRaw(sequences[i].bases());
+        profiles[i].emplace(counter);
+    });
+
+    std::vector<double> dist(n * n, 0.0);
+    parallelFor(n, num_workers, [&](size_t i) {
+        for (size_t j = i + 1; j < n; ++j) {
+            double d = 1.0 - stats::jaccardSimilarity(*profiles[i], *profiles[j]);
+            dist[i * n + j] = d;
+            dist[j * n + i] = d;
+        }
+    });
+    return dist;
+}
+
+/// UPGMA agglomeration: repeatedly join the closest pair of clusters,
+/// averaging distances weighted by cluster size. Returns 2n-1 nodes with
+/// the root last.
+std::vector<GuideNode> buildGuideTree(const std::vector<double>& leaf_dist,
+                                      size_t n) {
+    const size_t total = 2 * n - 1;
+
+    std::vector<GuideNode> nodes(n);
+    for (size_t i = 0; i < n; ++i) {
+        nodes[i].leaf = i;
+    }
+    nodes.reserve(total);
+
+    // Cluster distances indexed by node id; only active ids are read
+    std::vector<double> dist(total * total, 0.0);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            dist[i * total + j] = leaf_dist[i * n + j];
+        }
+    }
+
+    std::vector<size_t> active(n);
+    for (size_t i = 0; i < n; ++i) {
+        active[i] = i;
+    }
+
+    while (active.size() > 1) {
+        size_t best_a = 0;
+        size_t best_b = 1;
+        double best = std::numeric_limits<double>::max();
+        for (size_t a = 0; a < active.size(); ++a) {
+            for (size_t b = a + 1; b < active.size(); ++b) {
+                double d = dist[active[a] * total + active[b]];
+                if (d < best) {
+                    best = d;
+                    best_a = a;
+                    best_b = b;
+                }
+            }
+        }
+
+        const size_t left = active[best_a];
+        const size_t right = active[best_b];
+        const size_t merged = nodes.size();
+
+        GuideNode node;
+        node.left = static_cast<int>(left);
+        node.right = static_cast<int>(right);
+        node.leaves = nodes[left].leaves + nodes[right].leaves;
+        node.height = std::max(nodes[left].height, nodes[right].height) + 1;
+        nodes.push_back(node);
+
+        for (size_t c : active) {
+            if (c == left || c == right) {
+                continue;
+            }
+            double d = (static_cast<double>(nodes[left].leaves) *
+                            dist[left * total + c] +
+                        static_cast<double>(nodes[right].leaves) *
+                            dist[right * total + c]) /
+                       static_cast<double>(node.leaves);
+            dist[merged * total + c] = d;
+            dist[c * total + merged] = d;
+        }
+
+        active.erase(active.begin() + best_b);
+        active.erase(active.begin() + best_a);
+        active.push_back(merged);
+    }
+
+    return nodes;
+}
+
+/// A partial alignment: equal-length gapped rows plus per-column base
+/// frequencies (A, C, G, T, gap) for profile-profile scoring
+struct MSAProfile {
+    std::vector<size_t> members;  // input indices, parallel to rows
+    std::vector<std::string> rows;
+    std::vector<std::array<float, 5>> freq;
+};
+
+int baseSlot(char c) noexcept {
+    switch (c) {
+        case 'A': case 'a': return 0;
+        case 'C': case 'c': return 1;
+        case 'G': case 'g': return 2;
+        case 'T': case 't': return 3;
+        default: return 4;  // gaps and ambiguity codes
+    }
+}
+
+void computeFrequencies(MSAProfile& profile) {
+    const size_t length = profile.rows.empty() ? 0 : profile.rows[0].size();
+    profile.freq.assign(length, {});
+    for (const auto& row : profile.rows) {
+        for (size_t col = 0; col < length; ++col) {
+            profile.freq[col][baseSlot(row[col])] += 1.0f;
+        }
+    }
+    const float inv = 1.0f / static_cast<float>(profile.rows.size());
+    for (auto& column : profile.freq) {
+        for (float& f : column) {
+            f *= inv;
+        }
+    }
+}
+
+MSAProfile leafProfile(const Sequence& seq, size_t index) {
+    MSAProfile profile;
+    profile.members.push_back(index);
+    profile.rows.push_back(seq.bases());
+    computeFrequencies(profile);
+    return profile;
+}
+
+/// Expected pairwise score of stacking two profile columns: residue
+/// pairs score match/mismatch, residue-vs-gap pays the linear gap
+/// penalty, gap-vs-gap is free
+float columnScore(const std::array<float, 5>& f1,
+                  const std::array<float, 5>& f2,
+                  const ScoringMatrix& scoring) {
+    float score = 0.0f;
+    for (int a = 0; a < 4; ++a) {
+        if (f1[a] == 0.0f) {
+            continue;
+        }
+        for (int b = 0; b < 4; ++b) {
+            if (f2[b] == 0.0f) {
+                continue;
+            }
+            score += f1[a] * f2[b] *
+                     static_cast<float>(a == b ? scoring.match_score
+                                               : scoring.mismatch_penalty);
+        }
+    }
+    score += (f1[4] * (1.0f - f2[4]) + f2[4] * (1.0f - f1[4])) *
+             static_cast<float>(scoring.gapPenalty());
+    return score;
+}
+
+/// Global profile-profile alignment; emits a merged profile whose rows
+/// are the union of both inputs with new gap columns spliced in
+MSAProfile mergeProfiles(const MSAProfile& first,
+                         const MSAProfile& second,
+                         const ScoringMatrix& scoring) {
+    enum : uint8_t { Diagonal, Up, Left };
+
+    const size_t m = first.freq.size();
+    const size_t n = second.freq.size();
+    const float gap = static_cast<float>(scoring.gapPenalty());
+
+    std::vector<float> prev(n + 1);
+    std::vector<float> curr(n + 1);
+    std::vector<uint8_t> trace((m + 1) * (n + 1), Diagonal);
+
+    for (size_t j = 1; j <= n; ++j) {
+        prev[j] = static_cast<float>(j) * gap;
+        trace[j] = Left;
+    }
+    for (size_t i = 1; i <= m; ++i) {
+        curr[0] = static_cast<float>(i) * gap;
+        trace[i * (n + 1)] = Up;
+        for (size_t j = 1; j <= n; ++j) {
+            float diag =
+                prev[j - 1] + columnScore(first.freq[i - 1], second.freq[j - 1], scoring);
+            float up = prev[j] + gap;
+            float left = curr[j - 1] + gap;
+
+            float best = diag;
+            uint8_t dir = Diagonal;
+            if (up > best) {
+                best = up;
+                dir = Up;
+            }
+            if (left > best) {
+                best = left;
+                dir = Left;
+            }
+            curr[j] = best;
+            trace[i * (n + 1) + j] = dir;
+        }
+        std::swap(prev, curr);
+    }
+
+    // Recover the column operations root-to-leaf, then reverse
+    std::vector<uint8_t> ops;
+    ops.reserve(m + n);
+    size_t i = m;
+    size_t j = n;
+    while (i > 0 || j > 0) {
+        uint8_t dir = trace[i * (n + 1) + j];
+        ops.push_back(dir);
+        if (dir == Diagonal) {
+            --i;
+            --j;
+        } else if (dir == Up) {
+            --i;
+        } else {
+            --j;
+        }
+    }
+    std::reverse(ops.begin(), ops.end());
+
+    MSAProfile merged;
+    merged.members = first.members;
+    merged.members.insert(merged.members.end(), second.members.begin(),
+                          second.members.end());
+    merged.rows.reserve(first.rows.size() + second.rows.size());
+
+    for (const auto& row : first.rows) {
+        std::string updated;
+        updated.reserve(ops.size());
+        size_t col = 0;
+        for (uint8_t op : ops) {
+            updated += (op == Left) ? '-' : row[col++];
+        }
+        merged.rows.push_back(std::move(updated));
+    }
+    for (const auto& row : second.rows) {
+        std::string updated;
+        updated.reserve(ops.size());
+        size_t col = 0;
+        for (uint8_t op : ops) {
+            updated += (op == Up) ? '-' : row[col++];
+        }
+        merged.rows.push_back(std::move(updated));
+    }
+
+    computeFrequencies(merged);
+    return merged;
+}
+
+} // anonymous namespace
+
+std::vector<std::string> multipleAlignment(
+    const std::vector<Sequence>& sequences,
+    const ScoringMatrix& scoring,
+    size_t num_threads
+) {
+    if (sequences.empty()) {
+        return {};
+    }
+    if (sequences.size() == 1) {
+        return {sequences[0].bases()};
+    }
+
+    const size_t n = sequences.size();
+    const size_t num_workers =
+        num_threads != 0 ? num_threads
+                         : std::max<size_t>(1, std::thread::hardware_concurrency());
+
+    auto distances = kmerDistanceMatrix(sequences, num_workers);
+    auto nodes = buildGuideTree(distances, n);
+
+    // Evaluate the tree bottom-up. Nodes at the same height have
+    // disjoint subtrees, so each level is an independent parallel batch.
+    std::vector<std::optional<MSAProfile>> profiles(nodes.size());
+    for (size_t i = 0; i < n; ++i) {
+        profiles[i] = leafProfile(sequences[i], i);
+    }
+
+    const size_t max_height = nodes.back().height;
+    std::vector<size_t> level;
+    for (size_t height = 1; height <= max_height; ++height) {
+        level.clear();
+        for (size_t id = n; id < nodes.size(); ++id) {
+            if (nodes[id].height == height) {
+                level.push_back(id);
+            }
+        }
+        parallelFor(level.size(), num_workers, [&](size_t slot) {
+            const GuideNode& node = nodes[level[slot]];
+            auto& left = profiles[static_cast<size_t>(node.left)];
+            auto& right = profiles[static_cast<size_t>(node.right)];
+            profiles[level[slot]] = mergeProfiles(*left, *right, scoring);
+            left.reset();  // child rows are no longer needed
+            right.reset();
+        });
+    }
+
+    MSAProfile& root = *profiles.back();
+    std::vector<std::string> result(n);
+    for (size_t r = 0; r < root.rows.size(); ++r) {
+        result[root.members[r]] = std::move(root.rows[r]);
+    }
+    return result;
 }
 
 } // namespace bioflow
@@ -0,0 +1,601 @@
+#include "bioflow/decompress.hpp"
+#include "bioflow/instrument.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+#include <zlib.h>
+
+namespace bioflow {
+
+// ============================================================================
+// Format Detection
+// ============================================================================
+
+namespace {
+
+uint16_t readU16(std::string_view data, size_t offset) noexcept {
+    return static_cast<uint16_t>(
+        static_cast<unsigned char>(data[offset]) |
+        (static_cast<unsigned char>(data[offset + 1]) << 8));
+}
+
+uint32_t readU32(std::string_view data, size_t offset) noexcept {
+    return static_cast<uint32_t>(static_cast<unsigned char>(data[offset])) |
+           (static_cast<uint32_t>(static_cast<unsigned char>(data[offset + 1])) << 8) |
+           (static_cast<uint32_t>(static_cast<unsigned char>(data[offset + 2])) << 16) |
+           (static_cast<uint32_t>(static_cast<unsigned char>(data[offset + 3])) << 24);
+}
+
+constexpr size_t kBgzfHeaderSize = 18;  // fixed header incl. the BC subfield
+constexpr size_t kBgzfTrailerSize = 8;  // CRC32 + ISIZE
+
+// Returns the BSIZE value (total block length - 1) from the BC extra
+// subfield, or 0 if the member is not BGZF
+uint32_t bgzfBlockSize(std::string_view data) noexcept {
+    if (data.size() < kBgzfHeaderSize) return 0;
+    if (static_cast<unsigned char>(data[0]) != 0x1f ||
+        static_cast<unsigned char>(data[1]) != 0x8b ||
+        static_cast<unsigned char>(data[2]) != 0x08) {
+        return 0;
+    }
+    if ((static_cast<unsigned char>(data[3]) & 0x04) == 0) return 0;  // no FEXTRA
+
+    size_t xlen = readU16(data, 10);
+    size_t pos = 12;
+    size_t extra_end = pos + xlen;
+    if (extra_end > data.size()) return 0;
+
+    while (pos + 4 <= extra_end) {
+        char si1 = data[pos];
+        char si2 = data[pos + 1];
+        size_t sub_len = readU16(data, pos + 2);
+        if (si1 == 'B' && si2 == 'C' && sub_len == 2 && pos + 6 <= extra_end) {
+            return readU16(data, pos + 4);
+        }
+        pos += 4 + sub_len;
+    }
+    return 0;
+}
+
+[[noreturn]] void throwZlibError(const char* what, const z_stream& zs) {
+    std::string message = what;
+    if (zs.msg != nullptr) {
+        message += ": ";
+        message += zs.msg;
+    }
+    throw IOError(message);
+}
+
+} // anonymous namespace
+
+bool isGzip(std::string_view data) noexcept {
+    return data.size() >= 2 &&
+           static_cast<unsigned char>(data[0]) == 0x1f &&
+           static_cast<unsigned char>(data[1]) == 0x8b;
+}
+
+bool isBgzf(std::string_view data) noexcept {
+    return bgzfBlockSize(data) != 0;
+}
+
+std::unique_ptr<Decompressor> makeDecompressor(std::string_view data) {
+    if (isGzip(data)) {
+        return std::make_unique<GzipDecompressor>();
+    }
+    throw IOError("Unrecognized compressed input (gzip and BGZF are supported)");
+}
+
+// ============================================================================
+// GzipDecompressor Implementation
+// ============================================================================
+
+struct GzipDecompressor::State {
+    z_stream zs{};
+    bool finished = false;
+};
+
+GzipDecompressor::GzipDecompressor() : state_(std::make_unique<State>()) {
+    // 15 + 32: max window, auto-detect gzip or zlib wrapping
+    if (inflateInit2(&state_->zs, 15 + 32) != Z_OK) {
+        throw IOError("Failed to initialize zlib inflate state");
+    }
+}
+
+GzipDecompressor::~GzipDecompressor() {
+    inflateEnd(&state_->zs);
+}
+
+Decompressor::Result GzipDecompressor::decompress(std::string_view input,
+                                                  std::span<char> output) {
+    z_stream& zs = state_->zs;
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    zs.avail_in = static_cast<uInt>(input.size());
+    zs.next_out = reinterpret_cast<Bytef*>(output.data());
+    zs.avail_out = static_cast<uInt>(output.size());
+
+    while (zs.avail_out > 0) {
+        if (state_->finished) break;
+
+        int rc = inflate(&zs, Z_NO_FLUSH);
+
+        if (rc == Z_STREAM_END) {
+            if (zs.avail_in > 0) {
+                // Another member follows (concatenated gzip streams)
+                if (inflateReset(&zs) != Z_OK) {
+                    throwZlibError("Failed to reset gzip stream", zs);
+                }
+                continue;
+            }
+            state_->finished = true;
+            break;
+        }
+        if (rc == Z_OK || rc == Z_BUF_ERROR) {
+            if (zs.avail_in == 0) break;  // need more input
+            if (rc == Z_BUF_ERROR) {
+                throwZlibError("Gzip stream made no progress", zs);
+            }
+            continue;
+        }
+        throwZlibError("Corrupt gzip stream", zs);
+    }
+
+    BIOFLOW_COUNT(bytes_decompressed, output.size() - zs.avail_out);
+    return {
+        input.size() - zs.avail_in,
+        output.size() - zs.avail_out,
+        state_->finished
+    };
+}
+
+// ============================================================================
+// Whole-Buffer Helpers
+// ============================================================================
+
+std::string compressGzip(std::string_view data, int level) {
+    z_stream zs{};
+    // 15 + 16: gzip wrapper
+    if (deflateInit2(&zs, level, Z_DEFLATED, 15 + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw IOError("Failed to initialize zlib deflate state");
+    }
+
+    std::string out;
+    out.resize(deflateBound(&zs, static_cast<uLong>(data.size())));
+
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    zs.avail_in = static_cast<uInt>(data.size());
+    zs.next_out = reinterpret_cast<Bytef*>(out.data());
+    zs.avail_out = static_cast<uInt>(out.size());
+
+    int rc = deflate(&zs, Z_FINISH);
+    deflateEnd(&zs);
+    if (rc != Z_STREAM_END) {
+        throw IOError("Gzip compression failed");
+    }
+
+    out.resize(out.size() - zs.avail_out);
+    return out;
+}
+
+namespace {
+
+// BGZF caps total block length at 64 KiB; keeping the input payload
+// below that leaves room for deflate's incompressible-data overhead
+constexpr size_t kBgzfMaxPayload = 0xff00;
+
+// The fixed empty block every BGZF file ends with
+constexpr unsigned char kBgzfEofMarker[28] = {
+    0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0x06, 0x00, 0x42, 0x43, 0x02, 0x00, 0x1b, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+void appendBgzfBlock(std::string& out, std::string_view payload, int level) {
+    z_stream zs{};
+    // -15: raw deflate, the BGZF header and trailer are written by hand
+    if (deflateInit2(&zs, level, Z_DEFLATED, -15, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw IOError("Failed to initialize zlib deflate state");
+    }
+
+    std::string compressed;
+    compressed.resize(deflateBound(&zs, static_cast<uLong>(payload.size())));
+
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(payload.data()));
+    zs.avail_in = static_cast<uInt>(payload.size());
+    zs.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    zs.avail_out = static_cast<uInt>(compressed.size());
+
+    int rc = deflate(&zs, Z_FINISH);
+    deflateEnd(&zs);
+    if (rc != Z_STREAM_END) {
+        throw IOError("BGZF block compression failed");
+    }
+    compressed.resize(compressed.size() - zs.avail_out);
+
+    size_t total = kBgzfHeaderSize + compressed.size() + kBgzfTrailerSize;
+    if (total > 0x10000) {
+        throw IOError("BGZF block exceeds the 64 KiB format limit");
+    }
+    uint16_t bsize = static_cast<uint16_t>(total - 1);
+
+    const unsigned char header[kBgzfHeaderSize] = {
+        0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+        0x06, 0x00, 'B', 'C', 0x02, 0x00,
+        static_cast<unsigned char>(bsize & 0xff),
+        static_cast<unsigned char>(bsize >> 8)
+    };
+    out.append(reinterpret_cast<const char*>(header), sizeof(header));
+    out += compressed;
+
+    uint32_t crc = static_cast<uint32_t>(
+        crc32(crc32(0L, Z_NULL, 0),
+              reinterpret_cast<const Bytef*>(payload.data()),
+              static_cast<uInt>(payload.size())));
+    uint32_t isize = static_cast<uint32_t>(payload.size());
+    for (uint32_t value : {crc, isize}) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            out += static_cast<char>((value >> shift) & 0xff);
+        }
+    }
+}
+
+struct BgzfBlock {
+    size_t offset;             // of the block within the input
+    size_t compressed_size;    // whole block, header through trailer
+    size_t uncompressed_size;  // ISIZE
+};
+
+std::vector<BgzfBlock> parseBgzfBlocks(std::string_view data) {
+    std::vector<BgzfBlock> blocks;
+    size_t pos = 0;
+
+    while (pos < data.size()) {
+        uint32_t bsize = bgzfBlockSize(data.substr(pos));
+        if (bsize == 0) {
+            throw IOError("Corrupt BGZF block header at offset " +
+                          std::to_string(pos));
+        }
+
+        size_t total = size_t{bsize} + 1;
+        if (total < kBgzfHeaderSize + kBgzfTrailerSize ||
+            pos + total > data.size()) {
+            throw IOError("Truncated BGZF block at offset " +
+                          std::to_string(pos));
+        }
+
+        size_t isize = readU32(data, pos + total - 4);
+        if (isize > 0) {  // skip the empty EOF marker block
+            blocks.push_back({pos, total, isize});
+        }
+        pos += total;
+    }
+
+    return blocks;
+}
+
+// Inflate one raw-deflate BGZF payload into its output slice
+void inflateBgzfBlock(std::string_view data, const BgzfBlock& block,
+                      char* out) {
+    size_t xlen = readU16(data, block.offset + 10);
+    size_t payload_offset = block.offset + 12 + xlen;
+    size_t payload_size =
+        block.compressed_size - (12 + xlen) - kBgzfTrailerSize;
+
+    z_stream zs{};
+    if (inflateInit2(&zs, -15) != Z_OK) {
+        throw IOError("Failed to initialize zlib inflate state");
+    }
+
+    zs.next_in = reinterpret_cast<Bytef*>(
+        const_cast<char*>(data.data() + payload_offset));
+    zs.avail_in = static_cast<uInt>(payload_size);
+    zs.next_out = reinterpret_cast<Bytef*>(out);
+    zs.avail_out = static_cast<uInt>(block.uncompressed_size);
+
+    int rc = inflate(&zs, Z_FINISH);
+    bool complete = rc == Z_STREAM_END && zs.avail_out == 0;
+    inflateEnd(&zs);
+    if (!complete) {
+        throw IOError("Corrupt BGZF block at offset " +
+                      std::to_string(block.offset));
+    }
+    BIOFLOW_COUNT(bytes_decompressed, block.uncompressed_size);
+}
+
+// Fork-join over a run of blocks, each writing its own output slice
+void inflateBlocksInto(std::string_view data,
+                       std::span<const BgzfBlock> blocks,
+                       std::span<const size_t> out_offsets,
+                       char* out, size_t num_threads) {
+    size_t workers = num_threads != 0
+        ? num_threads
+        : std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min(workers, blocks.size());
+
+    if (workers <= 1) {
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            inflateBgzfBlock(data, blocks[i], out + out_offsets[i]);
+        }
+        return;
+    }
+
+    std::atomic<size_t> cursor{0};
+    std::exception_ptr first_error;
+    std::mutex error_mutex;
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers);
+    for (size_t w = 0; w < workers; ++w) {
+        threads.emplace_back([&]() {
+            try {
+                while (true) {
+                    size_t i = cursor.fetch_add(1, std::memory_order_relaxed);
+                    if (i >= blocks.size()) break;
+                    inflateBgzfBlock(data, blocks[i], out + out_offsets[i]);
+                }
+            } catch (...) {
+                std::lock_guard lock(error_mutex);
+                if (!first_error) {
+                    first_error = std::current_exception();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+} // anonymous namespace
+
+std::string compressBgzf(std::string_view data, size_t block_size, int level) {
+    block_size = std::min(std::max<size_t>(block_size, 1), kBgzfMaxPayload);
+
+    std::string out;
+    for (size_t pos = 0; pos < data.size(); pos += block_size) {
+        appendBgzfBlock(out, data.substr(pos, block_size), level);
+    }
+    out.append(reinterpret_cast<const char*>(kBgzfEofMarker),
+               sizeof(kBgzfEofMarker));
+    return out;
+}
+
+std::string decompressBgzfParallel(std::string_view data, size_t num_threads) {
+    if (!isBgzf(data)) {
+        throw IOError("Input is not BGZF");
+    }
+
+    auto blocks = parseBgzfBlocks(data);
+
+    std::vector<size_t> offsets(blocks.size());
+    size_t total = 0;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        offsets[i] = total;
+        total += blocks[i].uncompressed_size;
+    }
+
+    std::string out;
+    out.resize(total);
+    inflateBlocksInto(data, blocks, offsets, out.data(), num_threads);
+    return out;
+}
+
+// ============================================================================
+// DecompressingReader Implementation
+// ============================================================================
+
+DecompressingReader::DecompressingReader(const std::string& path,
+                                         size_t chunk_size)
+    : file_(std::in_place, path), chunk_size_(std::max<size_t>(chunk_size, 1)) {
+    data_ = file_->view();
+    start();
+}
+
+DecompressingReader::DecompressingReader(std::string_view buffer,
+                                         size_t chunk_size)
+    : data_(buffer), chunk_size_(std::max<size_t>(chunk_size, 1)) {
+    start();
+}
+
+DecompressingReader::~DecompressingReader() {
+    chunks_.close();  // unblock a producer waiting on a full queue
+    if (producer_.joinable()) {
+        producer_.join();
+    }
+}
+
+void DecompressingReader::start() {
+    producer_ = std::thread([this]() {
+        try {
+            if (isBgzf(data_)) {
+                produceBgzf();
+            } else if (isGzip(data_)) {
+                produceStream();
+            } else {
+                producePassthrough();
+            }
+        } catch (...) {
+            error_ = std::current_exception();
+        }
+        chunks_.close();
+    });
+}
+
+void DecompressingReader::produceStream() {
+    auto codec = makeDecompressor(data_);
+    size_t pos = 0;
+    bool finished = false;
+
+    while (!finished || pos < data_.size()) {
+        std::string chunk(chunk_size_, '\0');
+        size_t filled = 0;
+
+        while (filled < chunk.size()) {
+            auto result = codec->decompress(
+                data_.substr(pos), {chunk.data() + filled, chunk.size() - filled});
+            pos += result.consumed;
+            filled += result.produced;
+            finished = result.finished;
+
+            if (finished) break;
+            if (result.produced == 0 && result.consumed == 0) {
+                // Input ran out mid-stream
+                throw IOError("Truncated gzip stream");
+            }
+        }
+
+        chunk.resize(filled);
+        if (!chunk.empty() && !chunks_.push(std::move(chunk))) {
+            return;  // consumer went away
+        }
+    }
+}
+
+void DecompressingReader::produceBgzf() {
+    auto blocks = parseBgzfBlocks(data_);
+
+    // Group blocks until a chunk's worth of output, then inflate the
+    // group's blocks in parallel into one contiguous chunk
+    size_t begin = 0;
+    while (begin < blocks.size()) {
+        size_t end = begin;
+        size_t bytes = 0;
+        std::vector<size_t> offsets;
+        while (end < blocks.size() && bytes < chunk_size_) {
+            offsets.push_back(bytes);
+            bytes += blocks[end].uncompressed_size;
+            end++;
+        }
+
+        std::string chunk;
+        chunk.resize(bytes);
+        inflateBlocksInto(data_,
+                          std::span(blocks).subspan(begin, end - begin),
+                          offsets, chunk.data(), 0);
+
+        if (!chunks_.push(std::move(chunk))) return;
+        begin = end;
+    }
+}
+
+void DecompressingReader::producePassthrough() {
+    for (size_t pos = 0; pos < data_.size(); pos += chunk_size_) {
+        if (!chunks_.push(std::string(data_.substr(pos, chunk_size_)))) {
+            return;
+        }
+    }
+}
+
+bool DecompressingReader::nextChunk(std::string& chunk) {
+    auto item = chunks_.pop();
+    if (!item) {
+        if (error_) {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+        return false;
+    }
+    chunk = std::move(*item);
+    return true;
+}
+
+std::string DecompressingReader::readAll() {
+    std::string out;
+    std::string chunk;
+    while (nextChunk(chunk)) {
+        out += chunk;
+    }
+    return out;
+}
+
+// ============================================================================
+// CompressedFastqReader Implementation
+// ============================================================================
+
+CompressedFastqReader::CompressedFastqReader(const std::string& path,
+                                             QualityEncoding encoding)
+    : reader_(path), encoding_(encoding) {}
+
+CompressedFastqReader::CompressedFastqReader(std::string_view buffer,
+                                             QualityEncoding encoding)
+    : reader_(buffer), encoding_(encoding) {}
+
+bool CompressedFastqReader::refill() {
+    pending_.clear();
+    pending_pos_ = 0;
+
+    while (true) {
+        // Extend the record-boundary scan over freshly appended data;
+        // every 4th newline closes a record
+        while (scanned_ < window_.size()) {
+            size_t nl = findNewline(window_, scanned_);
+            if (nl >= window_.size()) {
+                scanned_ = window_.size();
+                break;
+            }
+            newlines_++;
+            scanned_ = nl + 1;
+            if (newlines_ % 4 == 0) {
+                complete_ = scanned_;
+            }
+        }
+
+        if (complete_ > 0) {
+            FastqReader parser(std::string_view(window_.data(), complete_));
+            FastqRecord record;
+            while (parser.next(record)) {
+                pending_.push_back(record.toQualifiedSequence(encoding_));
+            }
+            window_.erase(0, complete_);
+            scanned_ -= complete_;
+            complete_ = 0;
+            return true;
+        }
+
+        if (input_done_) {
+            if (window_.empty()) return false;
+            // Trailing data without a final newline: hand it to the
+            // parser whole, which also surfaces truncation errors
+            FastqReader parser{std::string_view(window_)};
+            FastqRecord record;
+            while (parser.next(record)) {
+                pending_.push_back(record.toQualifiedSequence(encoding_));
+            }
+            window_.clear();
+            scanned_ = 0;
+            newlines_ = 0;
+            return !pending_.empty();
+        }
+
+        std::string chunk;
+        if (reader_.nextChunk(chunk)) {
+            window_ += chunk;
+        } else {
+            input_done_ = true;
+        }
+    }
+}
+
+std::optional<QualifiedSequence> CompressedFastqReader::next() {
+    if (pending_pos_ >= pending_.size() && !refill()) {
+        return std::nullopt;
+    }
+    return std::move(pending_[pending_pos_++]);
+}
+
+std::vector<QualifiedSequence> CompressedFastqReader::readAll() {
+    std::vector<QualifiedSequence> records;
+    while (auto record = next()) {
+        records.push_back(std::move(*record));
+    }
+    return records;
+}
+
+} // namespace bioflow
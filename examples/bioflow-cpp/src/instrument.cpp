@@ -0,0 +1,72 @@
+#include "bioflow/instrument.hpp"
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+
+namespace bioflow::instrument {
+
+#if defined(BIOFLOW_INSTRUMENT)
+
+namespace detail {
+
+Counters& counters() noexcept {
+    static Counters instance;
+    return instance;
+}
+
+} // namespace detail
+
+bool enabled() noexcept {
+    return true;
+}
+
+Report snapshot() noexcept {
+    auto& c = detail::counters();
+    Report report;
+    report.bases_parsed = c.bases_parsed.load(std::memory_order_relaxed);
+    report.kmers_inserted = c.kmers_inserted.load(std::memory_order_relaxed);
+    report.dp_cells_filled = c.dp_cells_filled.load(std::memory_order_relaxed);
+    report.bytes_decompressed =
+        c.bytes_decompressed.load(std::memory_order_relaxed);
+    report.arena_bytes_allocated =
+        c.arena_bytes_allocated.load(std::memory_order_relaxed);
+    return report;
+}
+
+void reset() noexcept {
+    auto& c = detail::counters();
+    c.bases_parsed.store(0, std::memory_order_relaxed);
+    c.kmers_inserted.store(0, std::memory_order_relaxed);
+    c.dp_cells_filled.store(0, std::memory_order_relaxed);
+    c.bytes_decompressed.store(0, std::memory_order_relaxed);
+    c.arena_bytes_allocated.store(0, std::memory_order_relaxed);
+}
+
+#else
+
+bool enabled() noexcept {
+    return false;
+}
+
+Report snapshot() noexcept {
+    return {};
+}
+
+void reset() noexcept {}
+
+#endif
+
+std::string formatReport(const Report& report) {
+    std::ostringstream out;
+    auto line = [&](std::string_view name, uint64_t value) {
+        out << std::left << std::setw(24) << name << value << '\n';
+    };
+    line("bases_parsed", report.bases_parsed);
+    line("kmers_inserted", report.kmers_inserted);
+    line("dp_cells_filled", report.dp_cells_filled);
+    line("bytes_decompressed", report.bytes_decompressed);
+    line("arena_bytes_allocated", report.arena_bytes_allocated);
+    return out.str();
+}
+
+} // namespace bioflow::instrument
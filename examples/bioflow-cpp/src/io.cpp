@@ -0,0 +1,296 @@
+#include "bioflow/io.hpp"
+#include "bioflow/instrument.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace bioflow {
+
+// ============================================================================
+// MappedFile Implementation
+// ============================================================================
+
+MappedFile::MappedFile(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw IOError("Cannot open file: " + path);
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) < 0) {
+        ::close(fd);
+        throw IOError("Cannot stat file: " + path);
+    }
+
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+        void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            throw IOError("Cannot mmap file: " + path);
+        }
+        ::madvise(mapping, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(mapping);
+    }
+
+    // The mapping keeps the file alive; the descriptor is not needed
+    ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(other.data_), size_(other.size_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+        data_ = other.data_;
+        size_ = other.size_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+// ============================================================================
+// Newline Scanning
+// ============================================================================
+
+size_t findNewline(std::string_view text, size_t from) noexcept {
+    const char* data = text.data();
+    const size_t n = text.length();
+    size_t i = from;
+
+#if defined(__AVX2__)
+    const __m256i newline = _mm256_set1_epi8('\n');
+    while (i + 32 <= n) {
+        __m256i chunk = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + i));
+        uint32_t mask = static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newline)));
+        if (mask != 0) {
+            return i + static_cast<size_t>(std::countr_zero(mask));
+        }
+        i += 32;
+    }
+#elif defined(__SSE2__)
+    const __m128i newline = _mm_set1_epi8('\n');
+    while (i + 16 <= n) {
+        __m128i chunk = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + i));
+        uint32_t mask = static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline)));
+        if (mask != 0) {
+            return i + static_cast<size_t>(std::countr_zero(mask));
+        }
+        i += 16;
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (data[i] == '\n') return i;
+    }
+    return n;
+}
+
+namespace {
+
+// A line view with trailing '\r' stripped; advances pos past the '\n'
+std::string_view takeLine(std::string_view buffer, size_t& pos) {
+    size_t end = findNewline(buffer, pos);
+    std::string_view line = buffer.substr(pos, end - pos);
+    pos = end < buffer.length() ? end + 1 : end;
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+// Split a FASTA/FASTQ header line (without its marker) into id and
+// optional description
+void splitHeader(std::string_view header,
+                 std::string_view& id, std::string_view& description) {
+    size_t space = header.find(' ');
+    if (space == std::string_view::npos) {
+        id = header;
+        description = {};
+    } else {
+        id = header.substr(0, space);
+        description = header.substr(space + 1);
+    }
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// FASTA Reader Implementation
+// ============================================================================
+
+std::string FastaRecord::bases() const {
+    std::string result;
+    result.reserve(raw_bases.length());
+    size_t pos = 0;
+    while (pos < raw_bases.length()) {
+        std::string_view line = takeLine(raw_bases, pos);
+        result.append(line);
+    }
+    return result;
+}
+
+Sequence FastaRecord::toSequence() const {
+    return Sequence(bases(), std::string(id));
+}
+
+FastaReader::FastaReader(const std::string& path)
+    : file_(std::in_place, path), buffer_(file_->view()) {}
+
+FastaReader::FastaReader(std::string_view buffer) : buffer_(buffer) {}
+
+bool FastaReader::next(FastaRecord& record) {
+    // Skip blank lines between records
+    while (pos_ < buffer_.length() &&
+           (buffer_[pos_] == '\n' || buffer_[pos_] == '\r')) {
+        ++pos_;
+    }
+    if (pos_ >= buffer_.length()) {
+        return false;
+    }
+
+    if (buffer_[pos_] != '>') {
+        throw IOError("Malformed FASTA: expected '>' at offset " +
+                      std::to_string(pos_));
+    }
+    ++pos_;
+
+    std::string_view header = takeLine(buffer_, pos_);
+    splitHeader(header, record.id, record.description);
+
+    // Sequence lines run until the next header or end of input
+    size_t start = pos_;
+    while (pos_ < buffer_.length() && buffer_[pos_] != '>') {
+        pos_ = findNewline(buffer_, pos_);
+        if (pos_ < buffer_.length()) ++pos_;
+    }
+
+    size_t end = pos_;
+    while (end > start &&
+           (buffer_[end - 1] == '\n' || buffer_[end - 1] == '\r')) {
+        --end;
+    }
+    record.raw_bases = buffer_.substr(start, end - start);
+
+    return true;
+}
+
+std::vector<Sequence> FastaReader::readAll() {
+    std::vector<Sequence> sequences;
+    FastaRecord record;
+    while (next(record)) {
+        sequences.push_back(record.toSequence());
+    }
+    return sequences;
+}
+
+// ============================================================================
+// FASTQ Reader Implementation
+// ============================================================================
+
+QualifiedSequence FastqRecord::toQualifiedSequence(
+    QualityEncoding encoding) const {
+    return QualifiedSequence{
+        std::string(id),
+        std::string(bases),
+        QualityScores(quality, encoding),
+        description.empty()
+            ? std::nullopt
+            : std::make_optional(std::string(description))
+    };
+}
+
+QualifiedSequence FastqRecord::toQualifiedSequence(
+    QualityEncoding encoding, StringArena& ids) const {
+    return QualifiedSequence{
+        InternedString::borrowed(ids.intern(id)),
+        std::string(bases),
+        QualityScores(quality, encoding),
+        description.empty()
+            ? std::nullopt
+            : std::make_optional(
+                  InternedString::borrowed(ids.intern(description)))
+    };
+}
+
+FastqReader::FastqReader(const std::string& path)
+    : file_(std::in_place, path), buffer_(file_->view()) {}
+
+FastqReader::FastqReader(std::string_view buffer) : buffer_(buffer) {}
+
+bool FastqReader::next(FastqRecord& record) {
+    while (pos_ < buffer_.length() &&
+           (buffer_[pos_] == '\n' || buffer_[pos_] == '\r')) {
+        ++pos_;
+    }
+    if (pos_ >= buffer_.length()) {
+        return false;
+    }
+
+    if (buffer_[pos_] != '@') {
+        throw IOError("Malformed FASTQ: expected '@' at offset " +
+                      std::to_string(pos_));
+    }
+    ++pos_;
+
+    std::string_view header = takeLine(buffer_, pos_);
+    splitHeader(header, record.id, record.description);
+
+    record.bases = takeLine(buffer_, pos_);
+
+    if (pos_ >= buffer_.length() || buffer_[pos_] != '+') {
+        throw IOError("Malformed FASTQ: missing '+' separator for record '" +
+                      std::string(record.id) + "'");
+    }
+    (void)takeLine(buffer_, pos_);  // '+' line, optionally repeating the id
+
+    record.quality = takeLine(buffer_, pos_);
+
+    if (record.quality.length() != record.bases.length()) {
+        throw IOError("Malformed FASTQ: quality length " +
+                      std::to_string(record.quality.length()) +
+                      " does not match sequence length " +
+                      std::to_string(record.bases.length()) +
+                      " for record '" + std::string(record.id) + "'");
+    }
+
+    BIOFLOW_COUNT(bases_parsed, record.bases.length());
+    return true;
+}
+
+std::vector<QualifiedSequence> FastqReader::readAll(QualityEncoding encoding) {
+    std::vector<QualifiedSequence> sequences;
+    FastqRecord record;
+    while (next(record)) {
+        sequences.push_back(record.toQualifiedSequence(encoding));
+    }
+    return sequences;
+}
+
+} // namespace bioflow
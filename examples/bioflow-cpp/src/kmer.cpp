@@ -1,6 +1,13 @@
 #include "bioflow/kmer.hpp"
+#include "bioflow/instrument.hpp"
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <deque>
+#include <fstream>
 #include <stdexcept>
+#include <thread>
 
 namespace bioflow {
 
@@ -29,6 +36,7 @@ void KMerCounter::countRaw(std::string_view bases) {
 
         counts_[std::move(kmer)]++;
         total_++;
+        BIOFLOW_COUNT(kmers_inserted, 1);
     }
 }
 
@@ -146,6 +154,474 @@ void KMerCounter::merge(const KMerCounter& other) {
     }
 }
 
+// ============================================================================
+// Integer-Encoded K-mer Counting
+// ============================================================================
+
+namespace {
+
+// 2-bit base codes in lexicographic order, so encoded k-mers compare the
+// same way as their strings
+constexpr uint64_t baseCode(char c) noexcept {
+    switch (c) {
+        case 'A': return 0;
+        case 'C': return 1;
+        case 'G': return 2;
+        default:  return 3;  // 'T'
+    }
+}
+
+constexpr char baseChar(uint64_t code) noexcept {
+    constexpr char bases[4] = {'A', 'C', 'G', 'T'};
+    return bases[code & 0x3];
+}
+
+} // namespace
+
+uint64_t encodeKmer(std::string_view kmer) {
+    if (kmer.length() > 32) {
+        throw KMerError("Encoded k-mers support k up to 32");
+    }
+
+    uint64_t code = 0;
+    for (char c : kmer) {
+        code = (code << 2) | baseCode(c);
+    }
+    return code;
+}
+
+std::string decodeKmer(uint64_t code, size_t k) {
+    std::string kmer(k, 'A');
+    for (size_t i = 0; i < k; ++i) {
+        kmer[i] = baseChar(code >> (2 * (k - 1 - i)));
+    }
+    return kmer;
+}
+
+EncodedKMerCounter::EncodedKMerCounter(size_t k) : k_(k) {
+    if (k == 0) {
+        throw KMerError("K-mer length must be greater than 0");
+    }
+    if (k > 32) {
+        throw KMerError("EncodedKMerCounter supports k up to 32");
+    }
+    slots_.resize(kInitialCapacity, Slot{0, 0});
+}
+
+void EncodedKMerCounter::count(const Sequence& seq) {
+    countRaw(seq.bases());
+}
+
+void EncodedKMerCounter::countRaw(std::string_view bases) {
+    auto emit = [this](uint64_t code) {
+        insert(code, 1);
+        total_++;
+        BIOFLOW_COUNT(kmers_inserted, 1);
+    };
+    // Common production k values go through the fixed-K loop, where the
+    // mask and window test are compile-time constants
+    if (!withFixedKmerLength(k_, [&](auto fixed_k) {
+            forEachKmerCode<fixed_k()>(bases, emit);
+        })) {
+        forEachKmerCode(bases, k_, emit);
+    }
+}
+
+size_t EncodedKMerCounter::findSlot(uint64_t code) const noexcept {
+    size_t idx = hashKmerCode(code) & (slots_.size() - 1);
+    while (slots_[idx].count != 0 && slots_[idx].key != code) {
+        idx = (idx + 1) & (slots_.size() - 1);
+    }
+    return idx;
+}
+
+void EncodedKMerCounter::insert(uint64_t code, size_t occurrences) {
+    size_t idx = findSlot(code);
+    if (slots_[idx].count == 0) {
+        if ((size_ + 1) * 10 > slots_.size() * 7) {  // load factor 0.7
+            grow();
+            idx = findSlot(code);
+        }
+        slots_[idx].key = code;
+        size_++;
+    }
+    slots_[idx].count += occurrences;
+}
+
+void EncodedKMerCounter::grow() {
+    std::vector<Slot> old = std::move(slots_);
+    slots_.assign(old.size() * 2, Slot{0, 0});
+
+    for (const auto& slot : old) {
+        if (slot.count != 0) {
+            slots_[findSlot(slot.key)] = slot;
+        }
+    }
+}
+
+size_t EncodedKMerCounter::getCount(std::string_view kmer) const {
+    if (kmer.length() != k_ ||
+        kmer.find('N') != std::string_view::npos) {
+        return 0;
+    }
+    return getCount(encodeKmer(kmer));
+}
+
+size_t EncodedKMerCounter::getCount(uint64_t code) const noexcept {
+    return slots_[findSlot(code)].count;
+}
+
+bool EncodedKMerCounter::contains(std::string_view kmer) const {
+    return getCount(kmer) > 0;
+}
+
+std::vector<KMerEntry> EncodedKMerCounter::mostFrequent(size_t n) const {
+    auto result = allKmers();
+
+    auto end_it = result.begin() +
+        static_cast<std::ptrdiff_t>(std::min(n, result.size()));
+    std::partial_sort(result.begin(), end_it, result.end(),
+                     [](const KMerEntry& a, const KMerEntry& b) {
+                         return a.count > b.count;
+                     });
+
+    result.resize(std::min(n, result.size()));
+    return result;
+}
+
+std::vector<KMerEntry> EncodedKMerCounter::aboveThreshold(size_t threshold) const {
+    std::vector<KMerEntry> result;
+
+    forEach([&](uint64_t code, size_t count) {
+        if (count >= threshold) {
+            result.push_back({decodeKmer(code, k_), count});
+        }
+    });
+
+    std::ranges::sort(result, [](const KMerEntry& a, const KMerEntry& b) {
+        return a.count > b.count;
+    });
+
+    return result;
+}
+
+KMerSpectrum EncodedKMerCounter::spectrum() const {
+    KMerSpectrum spec;
+    spec.k = k_;
+    spec.unique_kmers = size_;
+    spec.total_kmers = total_;
+    spec.singleton_count = 0;
+
+    forEach([&](uint64_t, size_t count) {
+        if (count == 1) {
+            spec.singleton_count++;
+        }
+    });
+
+    spec.complexity = total_ > 0
+        ? static_cast<double>(spec.unique_kmers) / total_
+        : 0.0;
+
+    return spec;
+}
+
+std::vector<KMerEntry> EncodedKMerCounter::allKmers() const {
+    std::vector<KMerEntry> result;
+    result.reserve(size_);
+
+    forEach([&](uint64_t code, size_t count) {
+        result.push_back({decodeKmer(code, k_), count});
+    });
+
+    return result;
+}
+
+void EncodedKMerCounter::clear() noexcept {
+    std::ranges::fill(slots_, Slot{0, 0});
+    size_ = 0;
+    total_ = 0;
+}
+
+void EncodedKMerCounter::merge(const EncodedKMerCounter& other) {
+    if (other.k_ != k_) {
+        throw KMerError("Cannot merge k-mer counters with different k values");
+    }
+
+    other.forEach([&](uint64_t code, size_t count) {
+        insert(code, count);
+        total_ += count;
+    });
+}
+
+void EncodedKMerCounter::add(uint64_t code, size_t occurrences) {
+    if (occurrences == 0) return;
+    insert(code, occurrences);
+    total_ += occurrences;
+    BIOFLOW_COUNT(kmers_inserted, occurrences);
+}
+
+// ============================================================================
+// ParallelKMerCounter Implementation
+// ============================================================================
+
+ParallelKMerCounter::ParallelKMerCounter(size_t k, size_t num_threads)
+    : k_(k) {
+    if (k == 0) {
+        throw KMerError("K-mer length must be greater than 0");
+    }
+    if (k > 32) {
+        throw KMerError("ParallelKMerCounter supports k up to 32");
+    }
+
+    if (num_threads == 0) {
+        num_threads = std::thread::hardware_concurrency();
+        if (num_threads == 0) num_threads = 1;
+    }
+    num_threads_ = num_threads;
+    num_shards_ = std::bit_ceil(num_threads_);
+
+    shards_.reserve(num_shards_);
+    for (size_t s = 0; s < num_shards_; ++s) {
+        shards_.emplace_back(k_);
+    }
+}
+
+void ParallelKMerCounter::countAll(std::span<const Sequence> sequences) {
+    if (sequences.empty()) return;
+
+    // Phase 1: workers pull sequences off a shared cursor and count into
+    // worker-local shard tables, so no two threads touch the same table
+    std::vector<std::vector<EncodedKMerCounter>> locals(num_threads_);
+    for (auto& shard_set : locals) {
+        shard_set.reserve(num_shards_);
+        for (size_t s = 0; s < num_shards_; ++s) {
+            shard_set.emplace_back(k_);
+        }
+    }
+
+    std::atomic<size_t> cursor{0};
+
+    auto count_worker = [&](size_t worker) {
+        auto& shard_set = locals[worker];
+        for (;;) {
+            size_t i = cursor.fetch_add(1, std::memory_order_relaxed);
+            if (i >= sequences.size()) break;
+
+            forEachKmerCode(sequences[i].bases(), k_, [&](uint64_t code) {
+                shard_set[shardOf(code)].add(code, 1);
+            });
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads_);
+    for (size_t t = 0; t < num_threads_; ++t) {
+        workers.emplace_back(count_worker, t);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Phase 2: each thread owns a disjoint set of shard indices, merging
+    // that shard from every worker — contention-free by construction
+    auto merge_worker = [&](size_t first_shard) {
+        for (size_t s = first_shard; s < num_shards_; s += num_threads_) {
+            for (auto& shard_set : locals) {
+                shards_[s].merge(shard_set[s]);
+            }
+        }
+    };
+
+    workers.clear();
+    for (size_t t = 0; t < num_threads_; ++t) {
+        workers.emplace_back(merge_worker, t);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t ParallelKMerCounter::getCount(std::string_view kmer) const {
+    if (kmer.length() != k_ ||
+        kmer.find('N') != std::string_view::npos) {
+        return 0;
+    }
+    return getCount(encodeKmer(kmer));
+}
+
+size_t ParallelKMerCounter::getCount(uint64_t code) const noexcept {
+    return shards_[shardOf(code)].getCount(code);
+}
+
+bool ParallelKMerCounter::contains(std::string_view kmer) const {
+    return getCount(kmer) > 0;
+}
+
+std::vector<KMerEntry> ParallelKMerCounter::mostFrequent(size_t n) const {
+    auto result = allKmers();
+
+    auto end_it = result.begin() +
+        static_cast<std::ptrdiff_t>(std::min(n, result.size()));
+    std::partial_sort(result.begin(), end_it, result.end(),
+                     [](const KMerEntry& a, const KMerEntry& b) {
+                         return a.count > b.count;
+                     });
+
+    result.resize(std::min(n, result.size()));
+    return result;
+}
+
+KMerSpectrum ParallelKMerCounter::spectrum() const {
+    KMerSpectrum spec{};
+    spec.k = k_;
+
+    for (const auto& shard : shards_) {
+        auto partial = shard.spectrum();
+        spec.unique_kmers += partial.unique_kmers;
+        spec.total_kmers += partial.total_kmers;
+        spec.singleton_count += partial.singleton_count;
+    }
+
+    spec.complexity = spec.total_kmers > 0
+        ? static_cast<double>(spec.unique_kmers) / spec.total_kmers
+        : 0.0;
+
+    return spec;
+}
+
+std::vector<KMerEntry> ParallelKMerCounter::allKmers() const {
+    std::vector<KMerEntry> result;
+    result.reserve(uniqueCount());
+
+    for (const auto& shard : shards_) {
+        auto partial = shard.allKmers();
+        result.insert(result.end(),
+                      std::make_move_iterator(partial.begin()),
+                      std::make_move_iterator(partial.end()));
+    }
+
+    return result;
+}
+
+size_t ParallelKMerCounter::uniqueCount() const noexcept {
+    size_t count = 0;
+    for (const auto& shard : shards_) {
+        count += shard.uniqueCount();
+    }
+    return count;
+}
+
+size_t ParallelKMerCounter::totalCount() const noexcept {
+    size_t count = 0;
+    for (const auto& shard : shards_) {
+        count += shard.totalCount();
+    }
+    return count;
+}
+
+void ParallelKMerCounter::clear() noexcept {
+    for (auto& shard : shards_) {
+        shard.clear();
+    }
+}
+
+// ============================================================================
+// ConcurrentKMerCounter Implementation
+// ============================================================================
+
+ConcurrentKMerCounter::ConcurrentKMerCounter(size_t k, size_t expected_kmers)
+    : k_(k) {
+    if (k == 0 || k > 31) {
+        throw KMerError(
+            "Concurrent k-mer length must be between 1 and 31, got " +
+            std::to_string(k));
+    }
+    // Next power of two holding expected_kmers at ~0.7 load
+    num_slots_ = std::bit_ceil(std::max<size_t>(expected_kmers * 10 / 7, 64));
+    max_size_ = num_slots_ * 9 / 10;
+    slots_ = std::make_unique<Slot[]>(num_slots_);
+}
+
+void ConcurrentKMerCounter::count(const Sequence& seq) {
+    countRaw(seq.bases());
+}
+
+void ConcurrentKMerCounter::countRaw(std::string_view bases) {
+    auto emit = [this](uint64_t code) { add(code, 1); };
+    if (!withFixedKmerLength(k_, [&](auto fixed_k) {
+            forEachKmerCode<fixed_k()>(bases, emit);
+        })) {
+        forEachKmerCode(bases, k_, emit);
+    }
+}
+
+void ConcurrentKMerCounter::add(uint64_t code, size_t occurrences) {
+    if (occurrences == 0) return;
+
+    size_t idx = hashKmerCode(code) & (num_slots_ - 1);
+    for (size_t probes = 0; probes < num_slots_; ++probes) {
+        Slot& slot = slots_[idx];
+        uint64_t key = slot.key.load(std::memory_order_acquire);
+
+        if (key == kEmptySlot) {
+            if (size_.load(std::memory_order_relaxed) >= max_size_) {
+                break;  // refuse to fill the table solid
+            }
+            uint64_t expected = kEmptySlot;
+            if (slot.key.compare_exchange_strong(expected, code,
+                                                 std::memory_order_acq_rel)) {
+                size_.fetch_add(1, std::memory_order_relaxed);
+                key = code;
+            } else {
+                // Another thread claimed this slot first; if it claimed
+                // it for the same code we can still use it
+                key = expected;
+            }
+        }
+
+        if (key == code) {
+            slot.count.fetch_add(occurrences, std::memory_order_relaxed);
+            total_.fetch_add(occurrences, std::memory_order_relaxed);
+            BIOFLOW_COUNT(kmers_inserted, occurrences);
+            return;
+        }
+
+        idx = (idx + 1) & (num_slots_ - 1);
+    }
+
+    throw KMerError(
+        "Concurrent k-mer table is full (capacity " +
+        std::to_string(num_slots_) + "); size it for the expected panel");
+}
+
+size_t ConcurrentKMerCounter::getCount(uint64_t code) const noexcept {
+    size_t idx = hashKmerCode(code) & (num_slots_ - 1);
+    for (size_t probes = 0; probes < num_slots_; ++probes) {
+        const Slot& slot = slots_[idx];
+        uint64_t key = slot.key.load(std::memory_order_acquire);
+        if (key == code) {
+            return slot.count.load(std::memory_order_relaxed);
+        }
+        if (key == kEmptySlot) {
+            return 0;
+        }
+        idx = (idx + 1) & (num_slots_ - 1);
+    }
+    return 0;
+}
+
+size_t ConcurrentKMerCounter::getCount(std::string_view kmer) const {
+    if (kmer.length() != k_ ||
+        kmer.find('N') != std::string_view::npos) {
+        return 0;
+    }
+    return getCount(encodeKmer(kmer));
+}
+
+bool ConcurrentKMerCounter::contains(std::string_view kmer) const {
+    return getCount(kmer) > 0;
+}
+
 // ============================================================================
 // Canonical K-mer Functions
 // ============================================================================
@@ -173,50 +649,490 @@ std::string canonicalKmer(std::string_view kmer) {
 // CanonicalKMerCounter Implementation
 // ============================================================================
 
-CanonicalKMerCounter::CanonicalKMerCounter(size_t k) : k_(k) {
-    if (k == 0) {
-        throw KMerError("K-mer length must be greater than 0");
+CanonicalKMerCounter::CanonicalKMerCounter(size_t k) : counter_(k) {}
+
+void CanonicalKMerCounter::count(const Sequence& seq) {
+    auto emit = [this](uint64_t code) { counter_.add(code, 1); };
+    if (!withFixedKmerLength(k(), [&](auto fixed_k) {
+            forEachCanonicalKmerCode<fixed_k()>(seq.bases(), emit);
+        })) {
+        forEachCanonicalKmerCode(seq.bases(), k(), emit);
     }
 }
 
-void CanonicalKMerCounter::count(const Sequence& seq) {
-    const auto& bases = seq.bases();
-    if (bases.length() < k_) return;
+size_t CanonicalKMerCounter::getCount(std::string_view kmer) const {
+    if (kmer.find('N') != std::string_view::npos) return 0;
 
-    for (size_t i = 0; i <= bases.length() - k_; ++i) {
-        auto kmer = bases.substr(i, k_);
+    uint64_t canonical = 0;
+    forEachCanonicalKmerCode(kmer, k(), [&](uint64_t code) {
+        canonical = code;
+    });
+    return kmer.length() == k() ? counter_.getCount(canonical) : 0;
+}
+
+std::vector<KMerEntry> CanonicalKMerCounter::mostFrequent(size_t n) const {
+    return counter_.mostFrequent(n);
+}
+
+// ============================================================================
+// KMerProfile Implementation
+// ============================================================================
+
+KMerProfile::KMerProfile(const KMerCounter& counter)
+    : k_(counter.k()), total_(counter.totalCount()) {
+    if (k_ > 32) {
+        throw KMerError("KMerProfile supports k up to 32");
+    }
+
+    owned_.reserve(counter.uniqueCount());
+    for (const auto& [kmer, count] : counter) {
+        owned_.push_back({encodeKmer(kmer), count});
+    }
+    sortEntries();
+}
+
+KMerProfile::KMerProfile(const EncodedKMerCounter& counter)
+    : k_(counter.k()), total_(counter.totalCount()) {
+    owned_.reserve(counter.uniqueCount());
+    counter.forEach([this](uint64_t code, size_t count) {
+        owned_.push_back({code, count});
+    });
+    sortEntries();
+}
+
+KMerProfile::KMerProfile(const CanonicalKMerCounter& counter)
+    : k_(counter.k()), total_(counter.totalCount()) {
+    owned_.reserve(counter.uniqueCount());
+    counter.forEach([this](uint64_t code, size_t count) {
+        owned_.push_back({code, count});
+    });
+    sortEntries();
+}
+
+void KMerProfile::sortEntries() {
+    std::ranges::sort(owned_, {}, &Entry::code);
+    entries_ = owned_;
+}
+
+size_t KMerProfile::getCount(uint64_t code) const noexcept {
+    auto it = std::ranges::lower_bound(entries_, code, {}, &Entry::code);
+    return it != entries_.end() && it->code == code ? it->count : 0;
+}
+
+size_t KMerProfile::getCount(std::string_view kmer) const {
+    if (kmer.length() != k_) {
+        throw KMerError("K-mer length does not match profile k");
+    }
+    return getCount(encodeKmer(kmer));
+}
+
+// ============================================================================
+// Binary Serialization
+//
+// On-disk layout is a fixed 32-byte header followed by the raw sorted
+// entry array, little-endian, 8-byte aligned. The bulk payload is the
+// in-memory representation, so load() maps the file and reads it in
+// place; nothing beyond the header is parsed.
+// ============================================================================
+
+namespace {
+
+struct ProfileFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t k;
+    uint64_t unique_kmers;
+    uint64_t total_kmers;
+};
+
+static_assert(sizeof(ProfileFileHeader) == 32);
+static_assert(sizeof(KMerProfile::Entry) == 16);
+
+constexpr char kProfileMagic[4] = {'B', 'F', 'K', 'P'};
+constexpr uint32_t kProfileVersion = 1;
+
+} // anonymous namespace
+
+void KMerProfile::save(const std::filesystem::path& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw KMerError("Cannot open file for writing: " + path.string());
+    }
+
+    ProfileFileHeader header{};
+    std::copy(std::begin(kProfileMagic), std::end(kProfileMagic), header.magic);
+    header.version = kProfileVersion;
+    header.k = k_;
+    header.unique_kmers = entries_.size();
+    header.total_kmers = total_;
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries_.data()),
+              static_cast<std::streamsize>(entries_.size() * sizeof(Entry)));
+
+    if (!out) {
+        throw KMerError("Failed writing profile to: " + path.string());
+    }
+}
+
+KMerProfile KMerProfile::load(const std::filesystem::path& path) {
+    MappedFile file(path.string());
+    std::string_view view = file.view();
+
+    if (view.size() < sizeof(ProfileFileHeader)) {
+        throw KMerError("Profile file is truncated: " + path.string());
+    }
+
+    ProfileFileHeader header;
+    std::memcpy(&header, view.data(), sizeof(header));
+
+    if (!std::equal(std::begin(kProfileMagic), std::end(kProfileMagic),
+                    header.magic)) {
+        throw KMerError("Not a k-mer profile file: " + path.string());
+    }
+    if (header.version != kProfileVersion) {
+        throw KMerError("Unsupported profile version in: " + path.string());
+    }
+    if (header.k == 0 || header.k > 32) {
+        throw KMerError("Invalid k in profile file: " + path.string());
+    }
+    if (view.size() != sizeof(header) + header.unique_kmers * sizeof(Entry)) {
+        throw KMerError("Profile payload size mismatch in: " + path.string());
+    }
+
+    KMerProfile profile;
+    profile.k_ = header.k;
+    profile.total_ = header.total_kmers;
+    // The mapping is page-aligned and the header is 32 bytes, so the
+    // payload satisfies Entry alignment
+    profile.entries_ = {
+        reinterpret_cast<const Entry*>(view.data() + sizeof(header)),
+        header.unique_kmers
+    };
+    profile.file_ = std::move(file);
+    return profile;
+}
+
+void KMerCounter::save(const std::filesystem::path& path) const {
+    KMerProfile(*this).save(path);
+}
+
+KMerCounter KMerCounter::load(const std::filesystem::path& path) {
+    KMerProfile profile = KMerProfile::load(path);
+
+    KMerCounter counter(profile.k());
+    counter.counts_.reserve(profile.uniqueCount());
+    for (const auto& entry : profile) {
+        counter.counts_[decodeKmer(entry.code, profile.k())] = entry.count;
+    }
+    counter.total_ = profile.totalCount();
+    return counter;
+}
+
+void EncodedKMerCounter::save(const std::filesystem::path& path) const {
+    KMerProfile(*this).save(path);
+}
 
-        // Skip if contains N
-        if (kmer.find('N') != std::string::npos) continue;
+EncodedKMerCounter EncodedKMerCounter::load(const std::filesystem::path& path) {
+    KMerProfile profile = KMerProfile::load(path);
 
-        auto canonical = canonicalKmer(kmer);
-        counts_[std::move(canonical)]++;
+    EncodedKMerCounter counter(profile.k());
+    for (const auto& entry : profile) {
+        counter.add(entry.code, entry.count);
+    }
+    return counter;
+}
+
+void CanonicalKMerCounter::save(const std::filesystem::path& path) const {
+    counter_.save(path);
+}
+
+CanonicalKMerCounter CanonicalKMerCounter::load(const std::filesystem::path& path) {
+    CanonicalKMerCounter counter(1);
+    counter.counter_ = EncodedKMerCounter::load(path);
+    return counter;
+}
+
+// ============================================================================
+// CountMinSketch Implementation
+// ============================================================================
+
+CountMinSketch::CountMinSketch(size_t log2_width, size_t depth) {
+    if (depth == 0) {
+        throw KMerError("Count-min sketch depth must be greater than 0");
+    }
+    if (log2_width == 0 || log2_width > 32) {
+        throw KMerError("Count-min sketch width must be between 2^1 and 2^32 cells");
+    }
+
+    width_mask_ = (size_t{1} << log2_width) - 1;
+    depth_ = depth;
+    cells_.assign(depth_ * (width_mask_ + 1), 0);
+}
+
+size_t CountMinSketch::add(uint64_t code) noexcept {
+    uint8_t estimate = 255;
+    for (size_t row = 0; row < depth_; ++row) {
+        uint8_t& cell = cells_[cellIndex(code, row)];
+        if (cell < 255) {
+            ++cell;
+        }
+        estimate = std::min(estimate, cell);
+    }
+    return estimate;
+}
+
+size_t CountMinSketch::estimate(uint64_t code) const noexcept {
+    uint8_t estimate = 255;
+    for (size_t row = 0; row < depth_; ++row) {
+        estimate = std::min(estimate, cells_[cellIndex(code, row)]);
+    }
+    return estimate;
+}
+
+void CountMinSketch::clear() noexcept {
+    std::ranges::fill(cells_, 0);
+}
+
+// ============================================================================
+// PrefilteredKMerCounter Implementation
+// ============================================================================
+
+PrefilteredKMerCounter::PrefilteredKMerCounter(size_t k, size_t threshold,
+                                               size_t log2_sketch_width)
+    : threshold_(threshold), sketch_(log2_sketch_width), exact_(k) {
+    if (threshold == 0) {
+        throw KMerError("Admission threshold must be greater than 0");
+    }
+}
+
+void PrefilteredKMerCounter::count(const Sequence& seq) {
+    countRaw(seq.bases());
+}
+
+void PrefilteredKMerCounter::countRaw(std::string_view bases) {
+    forEachKmerCode(bases, k(), [this](uint64_t code) {
         total_++;
+
+        if (threshold_ == 1) {
+            exact_.add(code, 1);
+            return;
+        }
+
+        size_t estimate = sketch_.add(code);
+        if (estimate < threshold_) {
+            absorbed_++;
+            return;
+        }
+
+        // Collisions can make the estimate jump past the threshold, so
+        // admission is keyed off the exact table, not estimate equality
+        if (exact_.getCount(code) == 0) {
+            exact_.add(code, threshold_);
+            absorbed_ -= std::min(absorbed_, threshold_ - 1);
+        } else {
+            exact_.add(code, 1);
+        }
+    });
+}
+
+size_t PrefilteredKMerCounter::getCount(std::string_view kmer) const {
+    return exact_.getCount(kmer);
+}
+
+size_t PrefilteredKMerCounter::getCount(uint64_t code) const noexcept {
+    return exact_.getCount(code);
+}
+
+std::vector<KMerEntry> PrefilteredKMerCounter::mostFrequent(size_t n) const {
+    return exact_.mostFrequent(n);
+}
+
+std::vector<KMerEntry> PrefilteredKMerCounter::aboveThreshold(size_t threshold) const {
+    return exact_.aboveThreshold(threshold);
+}
+
+KMerSpectrum PrefilteredKMerCounter::spectrum() const {
+    KMerSpectrum spec = exact_.spectrum();
+
+    // Occurrences still absorbed by the sketch stand in for the unseen
+    // distinct k-mers; with the default threshold of 2 every pending
+    // k-mer has absorbed exactly one occurrence, so this is exact up
+    // to sketch collisions
+    spec.unique_kmers += absorbed_;
+    spec.singleton_count += absorbed_;
+    spec.total_kmers = total_;
+    spec.complexity = total_ > 0
+        ? static_cast<double>(spec.unique_kmers) / total_
+        : 0.0;
+
+    return spec;
+}
+
+void PrefilteredKMerCounter::clear() noexcept {
+    sketch_.clear();
+    exact_.clear();
+    total_ = 0;
+    absorbed_ = 0;
+}
+
+// ============================================================================
+// Minimizer Functions
+// ============================================================================
+
+std::vector<Minimizer> computeMinimizers(std::string_view bases,
+                                         size_t k, size_t w) {
+    if (k == 0 || k > 32) {
+        throw KMerError("K-mer length must be between 1 and 32");
     }
+    if (w == 0) {
+        throw KMerError("Minimizer window must be greater than 0");
+    }
+
+    std::vector<Minimizer> minimizers;
+    if (bases.length() < k) return minimizers;
+
+    const uint64_t mask = k == 32 ? ~uint64_t{0} : (uint64_t{1} << (2 * k)) - 1;
+    const size_t rc_shift = 2 * (k - 1);
+    uint64_t fwd = 0;
+    uint64_t rc = 0;
+    size_t valid = 0;
+
+    // Monotonic deque of (hash, code, position) with increasing hashes;
+    // the front is always the current window minimum
+    struct Entry {
+        uint64_t hash;
+        uint64_t code;
+        size_t position;
+    };
+    std::deque<Entry> window;
+    size_t run_kmers = 0;  // k-mers seen in the current N-free run
+
+    for (size_t i = 0; i < bases.length(); ++i) {
+        char c = bases[i];
+        if (c == 'N') {
+            valid = 0;
+            run_kmers = 0;
+            window.clear();
+            continue;
+        }
+
+        uint64_t b = (c == 'A') ? 0 : (c == 'C') ? 1 : (c == 'G') ? 2 : 3;
+        fwd = ((fwd << 2) | b) & mask;
+        rc = (rc >> 2) | ((b ^ 3) << rc_shift);
+        if (++valid < k) continue;
+
+        size_t pos = i + 1 - k;
+        uint64_t code = std::min(fwd, rc);
+        uint64_t hash = hashKmerCode(code);
+
+        while (!window.empty() && window.back().hash >= hash) {
+            window.pop_back();
+        }
+        window.push_back({hash, code, pos});
+
+        if (pos >= w && window.front().position + w <= pos) {
+            window.pop_front();
+        }
+
+        if (++run_kmers >= w) {
+            const Entry& best = window.front();
+            if (minimizers.empty() ||
+                minimizers.back().position != best.position) {
+                minimizers.push_back({best.code, best.position});
+            }
+        }
+    }
+
+    return minimizers;
 }
 
-size_t CanonicalKMerCounter::getCount(std::string_view kmer) const {
-    auto canonical = canonicalKmer(kmer);
-    auto it = counts_.find(canonical);
-    return it != counts_.end() ? it->second : 0;
+// ============================================================================
+// MinimizerIndex Implementation
+// ============================================================================
+
+MinimizerIndex::MinimizerIndex(size_t k, size_t w) : k_(k), w_(w) {
+    if (k == 0 || k > 32) {
+        throw KMerError("K-mer length must be between 1 and 32");
+    }
+    if (w == 0) {
+        throw KMerError("Minimizer window must be greater than 0");
+    }
 }
 
-std::vector<KMerEntry> CanonicalKMerCounter::mostFrequent(size_t n) const {
-    std::vector<KMerEntry> result;
-    result.reserve(counts_.size());
+void MinimizerIndex::build(const Sequence& reference) {
+    index_.clear();
+    reference_length_ = reference.length();
 
-    for (const auto& [kmer, count] : counts_) {
-        result.push_back({kmer, count});
+    for (const auto& minimizer : computeMinimizers(reference.bases(), k_, w_)) {
+        index_[minimizer.code].push_back(minimizer.position);
     }
+}
 
-    auto end_it = result.begin() + std::min(n, result.size());
-    std::partial_sort(result.begin(), end_it, result.end(),
-                     [](const KMerEntry& a, const KMerEntry& b) {
-                         return a.count > b.count;
-                     });
+std::vector<size_t> MinimizerIndex::positionsOf(uint64_t code) const {
+    auto it = index_.find(code);
+    return it != index_.end() ? it->second : std::vector<size_t>{};
+}
 
-    result.resize(std::min(n, result.size()));
-    return result;
+std::vector<MinimizerIndex::CandidateRegion> MinimizerIndex::findCandidates(
+    const Sequence& read, size_t min_hits) const {
+    std::vector<CandidateRegion> regions;
+    if (index_.empty()) return regions;
+
+    auto read_minimizers = computeMinimizers(read.bases(), k_, w_);
+    if (read_minimizers.empty()) return regions;
+
+    // Hits with a shared diagonal (reference position minus read
+    // position) come from the same placement; bucket the diagonal so
+    // indel drift within a placement still lands in one cluster
+    const int64_t bucket_width = static_cast<int64_t>(w_ + k_);
+    struct Cluster {
+        size_t hits = 0;
+        int64_t min_diag = std::numeric_limits<int64_t>::max();
+        int64_t max_diag = std::numeric_limits<int64_t>::min();
+    };
+    std::unordered_map<int64_t, Cluster> clusters;
+
+    for (const auto& minimizer : read_minimizers) {
+        auto it = index_.find(minimizer.code);
+        if (it == index_.end()) continue;
+
+        for (size_t ref_pos : it->second) {
+            int64_t diag = static_cast<int64_t>(ref_pos) -
+                           static_cast<int64_t>(minimizer.position);
+            int64_t bucket = diag >= 0
+                ? diag / bucket_width
+                : -((-diag + bucket_width - 1) / bucket_width);
+
+            Cluster& cluster = clusters[bucket];
+            cluster.hits++;
+            cluster.min_diag = std::min(cluster.min_diag, diag);
+            cluster.max_diag = std::max(cluster.max_diag, diag);
+        }
+    }
+
+    const int64_t pad = static_cast<int64_t>(w_ + k_);
+    const int64_t ref_len = static_cast<int64_t>(reference_length_);
+    const int64_t read_len = static_cast<int64_t>(read.length());
+
+    for (const auto& [bucket, cluster] : clusters) {
+        if (cluster.hits < min_hits) continue;
+
+        int64_t start = std::max<int64_t>(0, cluster.min_diag - pad);
+        int64_t end = std::min(ref_len, cluster.max_diag + read_len + pad);
+        if (start >= end) continue;
+
+        regions.push_back({static_cast<size_t>(start),
+                           static_cast<size_t>(end),
+                           cluster.hits});
+    }
+
+    std::ranges::sort(regions, [](const CandidateRegion& a,
+                                  const CandidateRegion& b) {
+        return a.hits > b.hits;
+    });
+
+    return regions;
 }
 
 } // namespace bioflow
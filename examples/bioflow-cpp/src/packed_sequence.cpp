@@ -0,0 +1,345 @@
+#include "bioflow/packed_sequence.hpp"
+#include <bit>
+#include <stdexcept>
+
+namespace bioflow {
+
+namespace {
+
+// Maps a byte holding four 2-bit base codes (LSB-first) to the byte with
+// the codes in reversed order. Combined with a 64-bit byte swap this
+// reverses base order across a whole word.
+constexpr std::array<uint8_t, 256> makeRevPairsTable() {
+    std::array<uint8_t, 256> table{};
+    for (int b = 0; b < 256; ++b) {
+        auto v = static_cast<uint8_t>(b);
+        table[static_cast<size_t>(b)] = static_cast<uint8_t>(
+            ((v & 0x03) << 6) | ((v & 0x0C) << 2) |
+            ((v & 0x30) >> 2) | ((v & 0xC0) >> 6));
+    }
+    return table;
+}
+
+constexpr auto kRevPairsByte = makeRevPairsTable();
+
+// Even bit positions of every 2-bit pair
+constexpr uint64_t kPairLowBits = 0x5555555555555555ULL;
+
+[[nodiscard]] uint64_t reversePairs(uint64_t word) noexcept {
+    uint64_t swapped = __builtin_bswap64(word);
+    uint64_t result = 0;
+    for (int i = 0; i < 8; ++i) {
+        auto byte = static_cast<uint8_t>(swapped >> (i * 8));
+        result |= static_cast<uint64_t>(kRevPairsByte[byte]) << (i * 8);
+    }
+    return result;
+}
+
+} // namespace
+
+// ============================================================================
+// Constructors
+// ============================================================================
+
+PackedSequence::PackedSequence(std::string_view bases) {
+    packFrom(bases);
+}
+
+PackedSequence::PackedSequence(std::string_view bases, std::string id)
+    : PackedSequence(bases) {
+    id_ = std::move(id);
+}
+
+PackedSequence::PackedSequence(const Sequence& seq)
+    : PackedSequence(seq.bases()) {
+    id_ = seq.id();
+}
+
+void PackedSequence::packFrom(std::string_view bases) {
+    if (bases.empty()) {
+        throw SequenceError("Sequence cannot be empty");
+    }
+
+    length_ = bases.length();
+    words_.assign((length_ + kBasesPerWord - 1) / kBasesPerWord, 0);
+    n_mask_.assign((length_ + 63) / 64, 0);
+
+    for (size_t i = 0; i < length_; ++i) {
+        char c = bases[i];
+        if (!Sequence::isValidBase(c)) {
+            throw SequenceError("Invalid base '" + std::string(1, c) +
+                              "' at position " + std::to_string(i));
+        }
+        if (c == 'N' || c == 'n') {
+            n_mask_[i / 64] |= uint64_t{1} << (i % 64);
+        } else {
+            words_[i / kBasesPerWord] |=
+                static_cast<uint64_t>(encodeBase(c)) << (2 * (i % kBasesPerWord));
+        }
+    }
+}
+
+// ============================================================================
+// Access
+// ============================================================================
+
+bool PackedSequence::isN(size_t index) const noexcept {
+    return (n_mask_[index / 64] >> (index % 64)) & 1;
+}
+
+uint64_t PackedSequence::tailWordMask() const noexcept {
+    size_t used = length_ % kBasesPerWord;
+    if (used == 0) return ~uint64_t{0};
+    return (~uint64_t{0}) >> (64 - 2 * used);
+}
+
+char PackedSequence::operator[](size_t index) const noexcept {
+    if (isN(index)) return 'N';
+    auto code = static_cast<uint8_t>(
+        words_[index / kBasesPerWord] >> (2 * (index % kBasesPerWord)));
+    return decodeBase(code);
+}
+
+char PackedSequence::at(size_t index) const {
+    if (index >= length_) {
+        throw std::out_of_range("PackedSequence index out of range");
+    }
+    return (*this)[index];
+}
+
+const std::string& PackedSequence::bases() const {
+    if (decoded_cache_.length() != length_) {
+        decoded_cache_.clear();
+        decoded_cache_.reserve(length_);
+        for (size_t i = 0; i < length_; ++i) {
+            decoded_cache_ += (*this)[i];
+        }
+    }
+    return decoded_cache_;
+}
+
+bool PackedSequence::hasAmbiguousBases() const noexcept {
+    for (uint64_t word : n_mask_) {
+        if (word != 0) return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// Content Analysis
+// ============================================================================
+
+double PackedSequence::gcContent() const noexcept {
+    if (length_ == 0) return 0.0;
+
+    // A pair encodes G or C exactly when its two bits differ
+    // (C=01, G=10 vs A=00, T=11). N positions are stored as 00.
+    size_t gc_count = 0;
+    for (uint64_t word : words_) {
+        gc_count += static_cast<size_t>(
+            std::popcount((word ^ (word >> 1)) & kPairLowBits));
+    }
+
+    return static_cast<double>(gc_count) / static_cast<double>(length_);
+}
+
+double PackedSequence::atContent() const noexcept {
+    if (length_ == 0) return 0.0;
+
+    auto counts = baseComposition();
+    return static_cast<double>(counts[0] + counts[3]) /
+           static_cast<double>(length_);
+}
+
+std::array<size_t, 5> PackedSequence::baseComposition() const noexcept {
+    std::array<size_t, 5> counts{};  // A, C, G, T, N
+
+    for (uint64_t word : words_) {
+        uint64_t hi = (word >> 1) & kPairLowBits;
+        uint64_t lo = word & kPairLowBits;
+        counts[1] += static_cast<size_t>(std::popcount(~hi & lo & kPairLowBits));  // C=01
+        counts[2] += static_cast<size_t>(std::popcount(hi & ~lo & kPairLowBits));  // G=10
+        counts[3] += static_cast<size_t>(std::popcount(hi & lo));                  // T=11
+    }
+
+    for (uint64_t word : n_mask_) {
+        counts[4] += static_cast<size_t>(std::popcount(word));
+    }
+
+    // N positions are stored as 00, so A is everything that remains
+    counts[0] = length_ - counts[1] - counts[2] - counts[3] - counts[4];
+    return counts;
+}
+
+size_t PackedSequence::countBase(char base) const noexcept {
+    auto counts = baseComposition();
+    switch (base) {
+        case 'A': case 'a': return counts[0];
+        case 'C': case 'c': return counts[1];
+        case 'G': case 'g': return counts[2];
+        case 'T': case 't': return counts[3];
+        case 'N': case 'n': return counts[4];
+        default: return 0;
+    }
+}
+
+// ============================================================================
+// Transformations
+// ============================================================================
+
+PackedSequence PackedSequence::complement() const {
+    PackedSequence result = *this;
+
+    // Complement is a bitwise NOT per pair: A=00 <-> T=11, C=01 <-> G=10
+    for (uint64_t& word : result.words_) {
+        word = ~word;
+    }
+    result.words_.back() &= tailWordMask();
+
+    // Restore the 00 placeholder at N positions (complement of N is N)
+    for (size_t wi = 0; wi < n_mask_.size(); ++wi) {
+        uint64_t mask = n_mask_[wi];
+        while (mask != 0) {
+            size_t pos = wi * 64 + static_cast<size_t>(std::countr_zero(mask));
+            result.words_[pos / kBasesPerWord] &=
+                ~(uint64_t{3} << (2 * (pos % kBasesPerWord)));
+            mask &= mask - 1;
+        }
+    }
+
+    result.decoded_cache_.clear();
+    return result;
+}
+
+PackedSequence PackedSequence::reverseComplement() const {
+    PackedSequence result;
+    result.length_ = length_;
+    result.id_ = id_;
+    result.n_mask_.assign(n_mask_.size(), 0);
+
+    // Complement every word, then reverse base order: byte-swap plus a
+    // 256-entry table that reverses the 2-bit groups within each byte.
+    const size_t n_words = words_.size();
+    std::vector<uint64_t> reversed(n_words);
+    for (size_t i = 0; i < n_words; ++i) {
+        uint64_t word = ~words_[n_words - 1 - i];
+        if (n_words - 1 - i == n_words - 1) {
+            word &= tailWordMask();
+        }
+        reversed[i] = reversePairs(word);
+    }
+
+    // The reversed array is left-padded by the unused tail of the last
+    // word; shift the whole bit array back down.
+    size_t pad_bases = (kBasesPerWord - length_ % kBasesPerWord) % kBasesPerWord;
+    size_t shift = 2 * pad_bases;
+    result.words_.assign(n_words, 0);
+    for (size_t i = 0; i < n_words; ++i) {
+        uint64_t word = reversed[i] >> shift;
+        if (shift != 0 && i + 1 < n_words) {
+            word |= reversed[i + 1] << (64 - shift);
+        }
+        result.words_[i] = word;
+    }
+    result.words_.back() &= tailWordMask();
+
+    // Mirror the N positions and clear their complemented codes
+    for (size_t wi = 0; wi < n_mask_.size(); ++wi) {
+        uint64_t mask = n_mask_[wi];
+        while (mask != 0) {
+            size_t pos = wi * 64 + static_cast<size_t>(std::countr_zero(mask));
+            size_t mirrored = length_ - 1 - pos;
+            result.n_mask_[mirrored / 64] |= uint64_t{1} << (mirrored % 64);
+            result.words_[mirrored / kBasesPerWord] &=
+                ~(uint64_t{3} << (2 * (mirrored % kBasesPerWord)));
+            mask &= mask - 1;
+        }
+    }
+
+    return result;
+}
+
+PackedSequence PackedSequence::subsequence(size_t start, size_t length) const {
+    if (start >= length_) {
+        throw SequenceError("Subsequence start position out of range");
+    }
+
+    size_t actual_length = std::min(length, length_ - start);
+
+    PackedSequence result;
+    result.length_ = actual_length;
+    result.words_.assign((actual_length + kBasesPerWord - 1) / kBasesPerWord, 0);
+    result.n_mask_.assign((actual_length + 63) / 64, 0);
+
+    // Shift the packed words down by the start offset
+    size_t word_offset = start / kBasesPerWord;
+    size_t bit_shift = 2 * (start % kBasesPerWord);
+    for (size_t i = 0; i < result.words_.size(); ++i) {
+        uint64_t word = words_[word_offset + i] >> bit_shift;
+        if (bit_shift != 0 && word_offset + i + 1 < words_.size()) {
+            word |= words_[word_offset + i + 1] << (64 - bit_shift);
+        }
+        result.words_[i] = word;
+    }
+    result.words_.back() &= result.tailWordMask();
+
+    // Same shift for the N-mask (1 bit per base)
+    size_t mask_offset = start / 64;
+    size_t mask_shift = start % 64;
+    for (size_t i = 0; i < result.n_mask_.size(); ++i) {
+        uint64_t word = n_mask_[mask_offset + i] >> mask_shift;
+        if (mask_shift != 0 && mask_offset + i + 1 < n_mask_.size()) {
+            word |= n_mask_[mask_offset + i + 1] << (64 - mask_shift);
+        }
+        result.n_mask_[i] = word;
+    }
+    if (actual_length % 64 != 0) {
+        result.n_mask_.back() &= (~uint64_t{0}) >> (64 - actual_length % 64);
+    }
+
+    if (id_) {
+        result.id_ = *id_ + "_" + std::to_string(start) + "_" +
+                     std::to_string(actual_length);
+    }
+    return result;
+}
+
+// ============================================================================
+// Conversion
+// ============================================================================
+
+Sequence PackedSequence::unpack() const {
+    Sequence result = makeSequenceUnchecked(bases());
+    if (id_) {
+        return Sequence(result.bases(), *id_);
+    }
+    return result;
+}
+
+std::string PackedSequence::toString() const {
+    std::string result;
+    if (id_) {
+        result += ">" + *id_ + "\n";
+    }
+    result += bases();
+    return result;
+}
+
+// ============================================================================
+// Operators
+// ============================================================================
+
+bool PackedSequence::operator==(const PackedSequence& other) const noexcept {
+    return length_ == other.length_ &&
+           words_ == other.words_ &&
+           n_mask_ == other.n_mask_ &&
+           id_ == other.id_;
+}
+
+size_t PackedSequence::memoryUsage() const noexcept {
+    return words_.capacity() * sizeof(uint64_t) +
+           n_mask_.capacity() * sizeof(uint64_t) +
+           (id_ ? id_->capacity() : 0);
+}
+
+} // namespace bioflow
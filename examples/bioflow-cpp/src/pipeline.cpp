@@ -0,0 +1,211 @@
+#include "bioflow/pipeline.hpp"
+#include <thread>
+
+namespace bioflow {
+
+// ============================================================================
+// FastqPipeline Implementation
+// ============================================================================
+
+FastqPipeline::FastqPipeline(const std::string& path, PipelineConfig config)
+    : config_(config), file_(std::in_place, path) {
+    buffer_ = file_->view();
+}
+
+FastqPipeline::FastqPipeline(std::string_view buffer, PipelineConfig config)
+    : config_(config), buffer_(buffer) {}
+
+namespace {
+
+size_t workerCount(const PipelineConfig& config) {
+    return config.worker_threads != 0
+        ? config.worker_threads
+        : std::max(1u, std::thread::hardware_concurrency());
+}
+
+} // namespace
+
+PipelineStats FastqPipeline::pump(
+    const std::function<void(RecordBatch&&, size_t worker)>& consume) {
+    const size_t workers = workerCount(config_);
+
+    BoundedQueue<RecordBatch> parsed(config_.queue_depth);
+
+    PipelineStats stats;
+    std::mutex stats_mutex;
+
+    std::exception_ptr first_error;
+    std::mutex error_mutex;
+    auto record_error = [&]() {
+        {
+            std::lock_guard lock(error_mutex);
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
+        // Unblock every stage so the pipeline can drain and join
+        parsed.close();
+    };
+
+    // Stage 1: parse batches off the mapped input. Running in its own
+    // thread is what overlaps I/O (page faults on the mapping) with
+    // the workers' compute.
+    std::thread reader_thread([&]() {
+        try {
+            FastqReader reader(buffer_);
+            FastqRecord record;
+
+            RecordBatch batch;
+            batch.reserve(config_.batch_size);
+            size_t records = 0;
+            size_t bases = 0;
+
+            while (reader.next(record)) {
+                // IDs become views into the pipeline-owned arena; only
+                // this thread interns, so the arena needs no locking
+                batch.push_back(
+                    record.toQualifiedSequence(config_.encoding, ids_));
+                records++;
+                bases += batch.back().length();
+
+                if (batch.size() >= config_.batch_size) {
+                    if (!parsed.push(std::move(batch))) break;  // shutting down
+                    batch = RecordBatch{};
+                    batch.reserve(config_.batch_size);
+                }
+            }
+            if (!batch.empty()) {
+                parsed.push(std::move(batch));
+            }
+
+            std::lock_guard lock(stats_mutex);
+            stats.records_parsed += records;
+            stats.bases_parsed += bases;
+        } catch (...) {
+            record_error();
+        }
+        parsed.close();
+    });
+
+    // Stage 2: trim + filter workers, handing survivors to the
+    // terminal stage
+    std::vector<std::thread> worker_threads;
+    worker_threads.reserve(workers);
+
+    for (size_t w = 0; w < workers; ++w) {
+        worker_threads.emplace_back([&, w]() {
+            try {
+                auto passes = makeQualityFilter(config_.min_mean_quality,
+                                                config_.min_length,
+                                                config_.max_length);
+                size_t records = 0;
+                size_t bases = 0;
+
+                while (auto batch = parsed.pop()) {
+                    RecordBatch kept;
+                    kept.reserve(batch->size());
+
+                    for (auto& record : *batch) {
+                        if (config_.trim_quality > 0) {
+                            record = record.trim(config_.trim_quality);
+                        }
+                        if (!passes(record)) continue;
+
+                        records++;
+                        bases += record.length();
+                        kept.push_back(std::move(record));
+                    }
+
+                    if (!kept.empty()) {
+                        consume(std::move(kept), w);
+                    }
+                }
+
+                std::lock_guard lock(stats_mutex);
+                stats.records_passed += records;
+                stats.bases_passed += bases;
+            } catch (...) {
+                record_error();
+            }
+        });
+    }
+
+    reader_thread.join();
+    for (auto& thread : worker_threads) {
+        thread.join();
+    }
+
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+    return stats;
+}
+
+PipelineStats FastqPipeline::run(const BatchSink& sink) {
+    BoundedQueue<RecordBatch> processed(config_.queue_depth);
+
+    PipelineStats stats;
+    std::exception_ptr pump_error;
+
+    std::thread pump_thread([&]() {
+        try {
+            stats = pump([&](RecordBatch&& batch, size_t) {
+                if (!processed.push(std::move(batch))) {
+                    throw PipelineError("Pipeline sink stopped accepting batches");
+                }
+            });
+        } catch (...) {
+            pump_error = std::current_exception();
+        }
+        processed.close();
+    });
+
+    // Terminal stage on the calling thread, so the sink needs no locking
+    std::exception_ptr sink_error;
+    try {
+        while (auto batch = processed.pop()) {
+            sink(std::move(*batch));
+        }
+    } catch (...) {
+        sink_error = std::current_exception();
+        processed.close();  // unblock the workers behind us
+    }
+
+    pump_thread.join();
+
+    // A sink failure also surfaces as a PipelineError in the workers;
+    // report the root cause
+    if (sink_error) std::rethrow_exception(sink_error);
+    if (pump_error) std::rethrow_exception(pump_error);
+    return stats;
+}
+
+FastqPipeline::KmerCountResult FastqPipeline::countKmers(size_t k) {
+    const size_t workers = workerCount(config_);
+
+    // Private table per worker: canonical codes, merged after the run
+    std::vector<EncodedKMerCounter> counters;
+    counters.reserve(workers);
+    for (size_t w = 0; w < workers; ++w) {
+        counters.emplace_back(k);
+    }
+
+    PipelineStats stats = pump([&](RecordBatch&& batch, size_t w) {
+        for (const auto& record : batch) {
+            forEachCanonicalKmerCode(record.bases, k, [&](uint64_t code) {
+                counters[w].add(code, 1);
+            });
+        }
+    });
+
+    EncodedKMerCounter merged = std::move(counters[0]);
+    for (size_t w = 1; w < workers; ++w) {
+        counters[w].forEach([&](uint64_t code, size_t count) {
+            merged.add(code, count);
+        });
+    }
+
+    return {std::move(merged), stats};
+}
+
+} // namespace bioflow
@@ -1,11 +1,113 @@
 #include "bioflow/quality.hpp"
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <numeric>
 #include <cmath>
 #include <ranges>
+#include <thread>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 namespace bioflow {
 
+namespace {
+
+// ============================================================================
+// Byte-wise SIMD kernels
+//
+// Quality scores are bounded uint8_t, so sums and threshold counts map
+// directly onto psadbw / byte-compare + movemask. These kernels run over
+// every base of every read in QC, hence the vector paths.
+// ============================================================================
+
+uint64_t sumBytes(const uint8_t* data, size_t length) {
+    uint64_t total = 0;
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + 32 <= length; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + i));
+        // psadbw against zero: horizontal byte sums into four u64 lanes
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(chunk, zero));
+    }
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + i));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(chunk, zero));
+    }
+    alignas(16) uint64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    total = lanes[0] + lanes[1];
+#endif
+
+    for (; i < length; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+size_t countGreaterEqual(const uint8_t* data, size_t length, uint8_t threshold) {
+    if (threshold == 0) return length;
+
+    size_t total = 0;
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256i limit = _mm256_set1_epi8(static_cast<char>(threshold));
+    for (; i + 32 <= length; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + i));
+        // Unsigned q >= t exactly when max(q, t) == q
+        __m256i ge = _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, limit), chunk);
+        total += static_cast<size_t>(std::popcount(
+            static_cast<uint32_t>(_mm256_movemask_epi8(ge))));
+    }
+#elif defined(__SSE2__)
+    const __m128i limit = _mm_set1_epi8(static_cast<char>(threshold));
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + i));
+        __m128i ge = _mm_cmpeq_epi8(_mm_max_epu8(chunk, limit), chunk);
+        total += static_cast<size_t>(std::popcount(
+            static_cast<uint32_t>(_mm_movemask_epi8(ge))));
+    }
+#endif
+
+    for (; i < length; ++i) {
+        if (data[i] >= threshold) total++;
+    }
+    return total;
+}
+
+// 10^(-q/10) for every representable quality; built by repeated
+// multiplication so it is usable in constant expressions
+constexpr std::array<double, 128> makePhredErrorTable() {
+    std::array<double, 128> table{};
+    constexpr double step = 0.79432823472428150206;  // 10^(-1/10)
+    double value = 1.0;
+    for (size_t q = 0; q < table.size(); ++q) {
+        table[q] = value;
+        value *= step;
+    }
+    return table;
+}
+
+constexpr auto kPhredErrorTable = makePhredErrorTable();
+
+} // anonymous namespace
+
 // ============================================================================
 // QualityScores Implementation
 // ============================================================================
@@ -65,8 +167,8 @@ char QualityScores::phredToAscii(uint8_t q, QualityEncoding encoding) {
 double QualityScores::meanQuality() const noexcept {
     if (scores_.empty()) return 0.0;
 
-    double sum = std::accumulate(scores_.begin(), scores_.end(), 0.0);
-    return sum / scores_.size();
+    return static_cast<double>(sumBytes(scores_.data(), scores_.size())) /
+           scores_.size();
 }
 
 double QualityScores::medianQuality() const noexcept {
@@ -108,13 +210,12 @@ double QualityScores::standardDeviation() const noexcept {
 }
 
 size_t QualityScores::countAboveThreshold(uint8_t threshold) const noexcept {
-    return static_cast<size_t>(std::ranges::count_if(scores_,
-        [threshold](uint8_t q) { return q >= threshold; }));
+    return countGreaterEqual(scores_.data(), scores_.size(), threshold);
 }
 
 size_t QualityScores::countBelowThreshold(uint8_t threshold) const noexcept {
-    return static_cast<size_t>(std::ranges::count_if(scores_,
-        [threshold](uint8_t q) { return q < threshold; }));
+    return scores_.size() -
+           countGreaterEqual(scores_.data(), scores_.size(), threshold);
 }
 
 double QualityScores::fractionAboveThreshold(uint8_t threshold) const noexcept {
@@ -126,7 +227,7 @@ double QualityScores::errorProbability(size_t index) const {
     if (index >= scores_.size()) {
         throw QualityError("Index out of range");
     }
-    return std::pow(10.0, -static_cast<double>(scores_[index]) / 10.0);
+    return kPhredErrorTable[scores_[index]];
 }
 
 double QualityScores::meanErrorProbability() const {
@@ -134,7 +235,7 @@ double QualityScores::meanErrorProbability() const {
 
     double sum = 0.0;
     for (uint8_t q : scores_) {
-        sum += std::pow(10.0, -static_cast<double>(q) / 10.0);
+        sum += kPhredErrorTable[q];
     }
     return sum / scores_.size();
 }
@@ -144,7 +245,7 @@ std::vector<double> QualityScores::errorProbabilities() const {
     probs.reserve(scores_.size());
 
     for (uint8_t q : scores_) {
-        probs.push_back(std::pow(10.0, -static_cast<double>(q) / 10.0));
+        probs.push_back(kPhredErrorTable[q]);
     }
 
     return probs;
@@ -184,20 +285,19 @@ std::vector<double> QualityScores::slidingWindowMean(size_t window_size) const {
         return {};
     }
 
-    std::vector<double> means;
-    means.reserve(scores_.size() - window_size + 1);
-
-    // Calculate first window
-    double sum = 0.0;
-    for (size_t i = 0; i < window_size; ++i) {
-        sum += scores_[i];
+    // Prefix sums turn every window into one subtraction, with no
+    // serial add/subtract dependency chain across windows
+    std::vector<uint64_t> prefix(scores_.size() + 1, 0);
+    for (size_t i = 0; i < scores_.size(); ++i) {
+        prefix[i + 1] = prefix[i] + scores_[i];
     }
-    means.push_back(sum / window_size);
 
-    // Slide window
-    for (size_t i = window_size; i < scores_.size(); ++i) {
-        sum = sum - scores_[i - window_size] + scores_[i];
-        means.push_back(sum / window_size);
+    std::vector<double> means;
+    means.reserve(scores_.size() - window_size + 1);
+    for (size_t i = 0; i + window_size <= scores_.size(); ++i) {
+        means.push_back(
+            static_cast<double>(prefix[i + window_size] - prefix[i]) /
+            window_size);
     }
 
     return means;
@@ -298,20 +398,147 @@ QualifiedSequence QualifiedSequence::trim(uint8_t quality_threshold,
                                           size_t min_length) const {
     auto [start, end] = quality.trimPositions(quality_threshold, min_length);
 
-    QualifiedSequence result;
-    result.id = id;
-    result.bases = bases.substr(start, end - start);
-    result.quality = quality.subsequence(start, end - start);
-    result.description = description;
-
-    return result;
+    return QualifiedSequence{
+        id,
+        bases.substr(start, end - start),
+        quality.subsequence(start, end - start),
+        description
+    };
 }
 
 // ============================================================================
 // Quality Report Functions
 // ============================================================================
 
-QualityReport generateQualityReport(const std::vector<QualifiedSequence>& sequences) {
+void QualityReportBuilder::addRecord(const QualifiedSequence& sequence) {
+    total_sequences_++;
+    total_bases_ += sequence.bases.length();
+
+    if (sequence.quality.length() > position_sums_.size()) {
+        position_sums_.resize(sequence.quality.length(), 0.0);
+        position_counts_.resize(sequence.quality.length(), 0);
+    }
+
+    for (size_t i = 0; i < sequence.quality.length(); ++i) {
+        uint8_t q = sequence.quality[i];
+        if (q < 94) {
+            quality_distribution_[q]++;
+        }
+        if (q >= 20) bases_above_q20_++;
+        if (q >= 30) bases_above_q30_++;
+
+        position_sums_[i] += q;
+        position_counts_[i]++;
+    }
+
+    double mean_q = sequence.quality.meanQuality();
+    sum_mean_quality_ += mean_q;
+
+    size_t bucket = std::min(
+        static_cast<size_t>(mean_q * 10.0 + 0.5),
+        kMeanQualityBuckets - 1);
+    mean_quality_histogram_[bucket]++;
+}
+
+QualityReport QualityReportBuilder::finalize() const {
+    QualityReport report{};
+
+    if (total_sequences_ == 0) {
+        return report;
+    }
+
+    report.total_sequences = total_sequences_;
+    report.total_bases = total_bases_;
+    report.bases_above_q20 = bases_above_q20_;
+    report.bases_above_q30 = bases_above_q30_;
+    report.quality_distribution = quality_distribution_;
+
+    report.mean_sequence_length =
+        static_cast<double>(total_bases_) / total_sequences_;
+    report.mean_quality = sum_mean_quality_ / total_sequences_;
+
+    // Median of per-record mean qualities from the 0.1-resolution
+    // histogram: walk to the middle rank(s)
+    size_t lower_rank = (total_sequences_ - 1) / 2;
+    size_t upper_rank = total_sequences_ / 2;
+    double lower_value = 0.0, upper_value = 0.0;
+    size_t seen = 0;
+    for (size_t bucket = 0; bucket < kMeanQualityBuckets; ++bucket) {
+        size_t next = seen + mean_quality_histogram_[bucket];
+        if (seen <= lower_rank && lower_rank < next) {
+            lower_value = bucket / 10.0;
+        }
+        if (seen <= upper_rank && upper_rank < next) {
+            upper_value = bucket / 10.0;
+            break;
+        }
+        seen = next;
+    }
+    report.median_quality = (lower_value + upper_value) / 2.0;
+
+    report.per_position_quality.resize(position_sums_.size(), 0.0);
+    for (size_t i = 0; i < position_sums_.size(); ++i) {
+        if (position_counts_[i] > 0) {
+            report.per_position_quality[i] =
+                position_sums_[i] / position_counts_[i];
+        }
+    }
+
+    return report;
+}
+
+namespace {
+
+/**
+ * @brief Per-thread accumulator for generateQualityReport()
+ *
+ * Everything a worker gathers from its slice of records is mergeable:
+ * counters add, position arrays add element-wise, and per-record mean
+ * qualities concatenate so the final median stays exact.
+ */
+struct ReportPartial {
+    size_t total_bases = 0;
+    size_t bases_above_q20 = 0;
+    size_t bases_above_q30 = 0;
+    std::vector<size_t> quality_distribution = std::vector<size_t>(94, 0);
+    std::vector<double> position_sums;
+    std::vector<size_t> position_counts;
+    std::vector<double> mean_qualities;
+
+    void scan(const std::vector<QualifiedSequence>& sequences,
+              size_t begin, size_t end) {
+        mean_qualities.reserve(end - begin);
+
+        for (size_t idx = begin; idx < end; ++idx) {
+            const auto& seq = sequences[idx];
+            total_bases += seq.bases.length();
+            mean_qualities.push_back(seq.quality.meanQuality());
+
+            const auto& scores = seq.quality.scores();
+            bases_above_q20 += countGreaterEqual(scores.data(), scores.size(), 20);
+            bases_above_q30 += countGreaterEqual(scores.data(), scores.size(), 30);
+
+            if (scores.size() > position_sums.size()) {
+                position_sums.resize(scores.size(), 0.0);
+                position_counts.resize(scores.size(), 0);
+            }
+
+            for (size_t i = 0; i < scores.size(); ++i) {
+                uint8_t q = scores[i];
+                if (q < 94) {
+                    quality_distribution[q]++;
+                }
+                position_sums[i] += q;
+                position_counts[i]++;
+            }
+        }
+    }
+};
+
+} // anonymous namespace
+
+QualityReport generateQualityReport(const std::vector<QualifiedSequence>& sequences,
+                                    size_t num_threads) {
     QualityReport report{};
 
     if (sequences.empty()) {
@@ -319,32 +546,66 @@ QualityReport generateQualityReport(const std::vector<QualifiedSequence>& sequen
     }
 
     report.total_sequences = sequences.size();
+
+    size_t workers = num_threads != 0
+        ? num_threads
+        : std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min(workers, sequences.size());
+
+    std::vector<ReportPartial> partials(workers);
+
+    if (workers <= 1) {
+        partials[0].scan(sequences, 0, sequences.size());
+    } else {
+        std::vector<std::thread> threads;
+        threads.reserve(workers);
+
+        for (size_t w = 0; w < workers; ++w) {
+            size_t begin = w * sequences.size() / workers;
+            size_t end = (w + 1) * sequences.size() / workers;
+            threads.emplace_back([&sequences, &partials, w, begin, end]() {
+                partials[w].scan(sequences, begin, end);
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    // Merge partials
     report.quality_distribution.resize(94, 0);  // Q0-Q93
 
     size_t max_length = 0;
-    std::vector<double> lengths;
-    std::vector<double> mean_qualities;
+    for (const auto& partial : partials) {
+        max_length = std::max(max_length, partial.position_sums.size());
+    }
 
-    for (const auto& seq : sequences) {
-        report.total_bases += seq.bases.length();
-        lengths.push_back(static_cast<double>(seq.bases.length()));
-        max_length = std::max(max_length, seq.bases.length());
+    report.per_position_quality.resize(max_length, 0.0);
+    std::vector<size_t> position_counts(max_length, 0);
+    std::vector<double> mean_qualities;
+    mean_qualities.reserve(sequences.size());
 
-        double mean_q = seq.quality.meanQuality();
-        mean_qualities.push_back(mean_q);
+    for (const auto& partial : partials) {
+        report.total_bases += partial.total_bases;
+        report.bases_above_q20 += partial.bases_above_q20;
+        report.bases_above_q30 += partial.bases_above_q30;
 
-        for (size_t i = 0; i < seq.quality.length(); ++i) {
-            uint8_t q = seq.quality[i];
-            if (q < 94) {
-                report.quality_distribution[q]++;
-            }
-            if (q >= 20) report.bases_above_q20++;
-            if (q >= 30) report.bases_above_q30++;
+        for (size_t q = 0; q < report.quality_distribution.size(); ++q) {
+            report.quality_distribution[q] += partial.quality_distribution[q];
         }
+        for (size_t i = 0; i < partial.position_sums.size(); ++i) {
+            report.per_position_quality[i] += partial.position_sums[i];
+            position_counts[i] += partial.position_counts[i];
+        }
+
+        mean_qualities.insert(mean_qualities.end(),
+                              partial.mean_qualities.begin(),
+                              partial.mean_qualities.end());
     }
 
-    report.mean_sequence_length = std::accumulate(lengths.begin(), lengths.end(), 0.0) /
-                                  lengths.size();
+    report.mean_sequence_length = static_cast<double>(report.total_bases) /
+                                  static_cast<double>(sequences.size());
     report.mean_quality = std::accumulate(mean_qualities.begin(), mean_qualities.end(), 0.0) /
                           mean_qualities.size();
 
@@ -357,17 +618,6 @@ QualityReport generateQualityReport(const std::vector<QualifiedSequence>& sequen
         report.median_quality = mean_qualities[mean_qualities.size()/2];
     }
 
-    // Per-position quality (up to max_length)
-    report.per_position_quality.resize(max_length, 0.0);
-    std::vector<size_t> position_counts(max_length, 0);
-
-    for (const auto& seq : sequences) {
-        for (size_t i = 0; i < seq.quality.length(); ++i) {
-            report.per_position_quality[i] += seq.quality[i];
-            position_counts[i]++;
-        }
-    }
-
     for (size_t i = 0; i < max_length; ++i) {
         if (position_counts[i] > 0) {
             report.per_position_quality[i] /= position_counts[i];
@@ -377,20 +627,32 @@ QualityReport generateQualityReport(const std::vector<QualifiedSequence>& sequen
     return report;
 }
 
+std::function<bool(const QualifiedSequence&)> makeQualityFilter(
+    double min_mean_quality,
+    std::optional<size_t> min_length,
+    std::optional<size_t> max_length
+) {
+    return [=](const QualifiedSequence& seq) {
+        if (!seq.passesQualityFilter(min_mean_quality)) return false;
+        if (min_length && !seq.passesLengthFilter(*min_length, max_length)) return false;
+        if (!min_length && max_length && seq.bases.length() > *max_length) return false;
+        return true;
+    };
+}
+
 std::vector<QualifiedSequence> filterByQuality(
     const std::vector<QualifiedSequence>& sequences,
     double min_mean_quality,
     std::optional<size_t> min_length,
     std::optional<size_t> max_length
 ) {
-    std::vector<QualifiedSequence> filtered;
+    auto passes = makeQualityFilter(min_mean_quality, min_length, max_length);
 
+    std::vector<QualifiedSequence> filtered;
     for (const auto& seq : sequences) {
-        if (!seq.passesQualityFilter(min_mean_quality)) continue;
-        if (min_length && !seq.passesLengthFilter(*min_length, max_length)) continue;
-        if (!min_length && max_length && seq.bases.length() > *max_length) continue;
-
-        filtered.push_back(seq);
+        if (passes(seq)) {
+            filtered.push_back(seq);
+        }
     }
 
     return filtered;
@@ -1,10 +1,108 @@
 #include "bioflow/sequence.hpp"
+#include <bit>
 #include <cctype>
 #include <sstream>
 #include <iostream>
 
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 namespace bioflow {
 
+// ============================================================================
+// Vectorized Counting Kernels
+// ============================================================================
+
+namespace {
+
+// Counts positions equal to either of two target bytes using
+// compare-and-popcount over wide chunks, with a scalar tail. The second
+// target may equal the first to count a single base.
+size_t countEitherByte(const char* data, size_t n, char t1, char t2) noexcept {
+    size_t count = 0;
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256i v1 = _mm256_set1_epi8(t1);
+    const __m256i v2 = _mm256_set1_epi8(t2);
+    for (; i + 32 <= n; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + i));
+        __m256i hits = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, v1),
+                                       _mm256_cmpeq_epi8(chunk, v2));
+        count += static_cast<size_t>(std::popcount(
+            static_cast<uint32_t>(_mm256_movemask_epi8(hits))));
+    }
+#elif defined(__SSE2__)
+    const __m128i v1 = _mm_set1_epi8(t1);
+    const __m128i v2 = _mm_set1_epi8(t2);
+    for (; i + 16 <= n; i += 16) {
+        __m128i chunk = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + i));
+        __m128i hits = _mm_or_si128(_mm_cmpeq_epi8(chunk, v1),
+                                    _mm_cmpeq_epi8(chunk, v2));
+        count += static_cast<size_t>(std::popcount(
+            static_cast<uint32_t>(_mm_movemask_epi8(hits))));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (data[i] == t1 || data[i] == t2) ++count;
+    }
+    return count;
+}
+
+// All five base counts in one pass: one load per chunk, five
+// compare-and-popcounts against it.
+std::array<size_t, 5> countComposition(const char* data, size_t n) noexcept {
+    std::array<size_t, 5> counts{};  // A, C, G, T, N
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256i targets[5] = {
+        _mm256_set1_epi8('A'), _mm256_set1_epi8('C'), _mm256_set1_epi8('G'),
+        _mm256_set1_epi8('T'), _mm256_set1_epi8('N')
+    };
+    for (; i + 32 <= n; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + i));
+        for (size_t b = 0; b < 5; ++b) {
+            counts[b] += static_cast<size_t>(std::popcount(
+                static_cast<uint32_t>(_mm256_movemask_epi8(
+                    _mm256_cmpeq_epi8(chunk, targets[b])))));
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i targets[5] = {
+        _mm_set1_epi8('A'), _mm_set1_epi8('C'), _mm_set1_epi8('G'),
+        _mm_set1_epi8('T'), _mm_set1_epi8('N')
+    };
+    for (; i + 16 <= n; i += 16) {
+        __m128i chunk = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + i));
+        for (size_t b = 0; b < 5; ++b) {
+            counts[b] += static_cast<size_t>(std::popcount(
+                static_cast<uint32_t>(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(chunk, targets[b])))));
+        }
+    }
+#endif
+
+    for (; i < n; ++i) {
+        switch (data[i]) {
+            case 'A': counts[0]++; break;
+            case 'C': counts[1]++; break;
+            case 'G': counts[2]++; break;
+            case 'T': counts[3]++; break;
+            case 'N': counts[4]++; break;
+        }
+    }
+    return counts;
+}
+
+} // namespace
+
 // ============================================================================
 // Constructors
 // ============================================================================
@@ -25,11 +123,6 @@ Sequence::Sequence(std::string_view bases, std::string id)
 // Validation
 // ============================================================================
 
-constexpr bool Sequence::isValidBase(char c) noexcept {
-    c = toUpper(c);
-    return c == 'A' || c == 'C' || c == 'G' || c == 'T' || c == 'N';
-}
-
 bool Sequence::isValid() const noexcept {
     return std::ranges::all_of(bases_, [](char c) { return isValidBase(c); });
 }
@@ -58,65 +151,30 @@ void Sequence::validateBases(std::string_view bases) {
 double Sequence::gcContent() const noexcept {
     if (bases_.empty()) return 0.0;
 
-    auto gc_count = std::ranges::count_if(bases_, [](char c) {
-        return c == 'G' || c == 'C';
-    });
-
+    size_t gc_count = countEitherByte(bases_.data(), bases_.length(), 'G', 'C');
     return static_cast<double>(gc_count) / static_cast<double>(bases_.length());
 }
 
 double Sequence::atContent() const noexcept {
     if (bases_.empty()) return 0.0;
 
-    auto at_count = std::ranges::count_if(bases_, [](char c) {
-        return c == 'A' || c == 'T';
-    });
-
+    size_t at_count = countEitherByte(bases_.data(), bases_.length(), 'A', 'T');
     return static_cast<double>(at_count) / static_cast<double>(bases_.length());
 }
 
 size_t Sequence::countBase(char base) const noexcept {
     base = toUpper(base);
-    return static_cast<size_t>(std::ranges::count(bases_, base));
+    return countEitherByte(bases_.data(), bases_.length(), base, base);
 }
 
 std::array<size_t, 5> Sequence::baseComposition() const noexcept {
-    std::array<size_t, 5> counts{};  // A, C, G, T, N
-
-    for (char c : bases_) {
-        switch (c) {
-            case 'A': counts[0]++; break;
-            case 'C': counts[1]++; break;
-            case 'G': counts[2]++; break;
-            case 'T': counts[3]++; break;
-            case 'N': counts[4]++; break;
-        }
-    }
-
-    return counts;
+    return countComposition(bases_.data(), bases_.length());
 }
 
 // ============================================================================
 // Transformations
 // ============================================================================
 
-constexpr char Sequence::toUpper(char c) noexcept {
-    if (c >= 'a' && c <= 'z') {
-        return static_cast<char>(c - 'a' + 'A');
-    }
-    return c;
-}
-
-constexpr char Sequence::complementBase(char c) noexcept {
-    switch (c) {
-        case 'A': return 'T';
-        case 'T': return 'A';
-        case 'C': return 'G';
-        case 'G': return 'C';
-        default: return 'N';
-    }
-}
-
 Sequence Sequence::complement() const {
     std::string comp;
     comp.reserve(bases_.length());
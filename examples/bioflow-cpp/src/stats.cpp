@@ -1,7 +1,8 @@
 #include "bioflow/stats.hpp"
 #include <cmath>
+#include <limits>
 #include <numeric>
-#include <set>
+#include <thread>
 
 namespace bioflow {
 namespace stats {
@@ -109,36 +110,129 @@ double cpgRatio(const Sequence& seq) {
 // Collection Statistics
 // ============================================================================
 
-CollectionStats computeCollectionStats(const std::vector<Sequence>& sequences) {
+namespace {
+
+/**
+ * @brief Per-thread accumulator for computeCollectionStats()
+ *
+ * Each worker folds its contiguous slice of the collection into one of
+ * these; lengths are sorted descending before the merge so the combined
+ * vector is built with linear merges instead of a final O(n log n) sort.
+ */
+struct CollectionPartial {
+    std::vector<size_t> lengths;  // sorted descending after scan()
+    RunningStats length_stats;
+    RunningStats gc_stats;
+    size_t total_bases = 0;
+    size_t min_length = std::numeric_limits<size_t>::max();
+    size_t max_length = 0;
+
+    void scan(const std::vector<Sequence>& sequences, size_t begin, size_t end) {
+        lengths.reserve(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+            size_t len = sequences[i].length();
+            lengths.push_back(len);
+            length_stats.add(static_cast<double>(len));
+            gc_stats.add(sequences[i].gcContent());
+            total_bases += len;
+            min_length = std::min(min_length, len);
+            max_length = std::max(max_length, len);
+        }
+        std::ranges::sort(lengths, std::greater{});
+    }
+};
+
+/// N50/L50 scan over lengths that are already sorted descending
+std::pair<size_t, size_t> n50FromSortedLengths(const std::vector<size_t>& lengths) {
+    size_t total = std::accumulate(lengths.begin(), lengths.end(), size_t{0});
+    size_t half = total / 2;
+
+    size_t cumsum = 0;
+    size_t l50 = 0;
+
+    for (size_t len : lengths) {
+        cumsum += len;
+        l50++;
+        if (cumsum >= half) {
+            return {len, l50};
+        }
+    }
+
+    return {lengths.back(), lengths.size()};
+}
+
+} // anonymous namespace
+
+CollectionStats computeCollectionStats(const std::vector<Sequence>& sequences,
+                                       size_t num_threads) {
     CollectionStats stats{};
 
     if (sequences.empty()) return stats;
 
     stats.sequence_count = sequences.size();
 
-    std::vector<size_t> lengths;
-    std::vector<double> gc_values;
-    lengths.reserve(sequences.size());
-    gc_values.reserve(sequences.size());
+    size_t workers = num_threads != 0
+        ? num_threads
+        : std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min(workers, sequences.size());
+
+    std::vector<CollectionPartial> partials(workers);
+
+    if (workers <= 1) {
+        partials[0].scan(sequences, 0, sequences.size());
+    } else {
+        std::vector<std::thread> threads;
+        threads.reserve(workers);
+
+        for (size_t w = 0; w < workers; ++w) {
+            size_t begin = w * sequences.size() / workers;
+            size_t end = (w + 1) * sequences.size() / workers;
+            threads.emplace_back([&sequences, &partials, w, begin, end]() {
+                partials[w].scan(sequences, begin, end);
+            });
+        }
 
-    for (const auto& seq : sequences) {
-        lengths.push_back(seq.length());
-        gc_values.push_back(seq.gcContent());
-        stats.total_bases += seq.length();
+        for (auto& thread : threads) {
+            thread.join();
+        }
     }
 
-    stats.mean_length = mean(lengths);
-    stats.median_length = median(lengths);
-    stats.std_length = standardDeviation(lengths);
+    // Merge partials: moment accumulators combine directly, the sorted
+    // length slices combine with pairwise linear merges
+    RunningStats length_stats;
+    RunningStats gc_stats;
+    std::vector<size_t> lengths = std::move(partials[0].lengths);
+    stats.min_length = std::numeric_limits<size_t>::max();
+
+    for (const auto& partial : partials) {
+        length_stats.merge(partial.length_stats);
+        gc_stats.merge(partial.gc_stats);
+        stats.total_bases += partial.total_bases;
+        stats.min_length = std::min(stats.min_length, partial.min_length);
+        stats.max_length = std::max(stats.max_length, partial.max_length);
+    }
+
+    for (size_t w = 1; w < workers; ++w) {
+        std::vector<size_t> merged;
+        merged.reserve(lengths.size() + partials[w].lengths.size());
+        std::ranges::merge(lengths, partials[w].lengths,
+                           std::back_inserter(merged), std::greater{});
+        lengths = std::move(merged);
+    }
 
-    auto [min_it, max_it] = std::minmax_element(lengths.begin(), lengths.end());
-    stats.min_length = *min_it;
-    stats.max_length = *max_it;
+    stats.mean_length = length_stats.mean();
+    stats.std_length = length_stats.standardDeviation();
+    stats.mean_gc = gc_stats.mean();
+    stats.std_gc = gc_stats.standardDeviation();
 
-    stats.mean_gc = mean(gc_values);
-    stats.std_gc = standardDeviation(gc_values);
+    // lengths is sorted descending, so the median reads off by index
+    size_t n = lengths.size();
+    stats.median_length = n % 2 != 0
+        ? static_cast<double>(lengths[n / 2])
+        : (static_cast<double>(lengths[n / 2 - 1]) +
+           static_cast<double>(lengths[n / 2])) / 2.0;
 
-    auto [n50, l50] = computeN50L50(lengths);
+    auto [n50, l50] = n50FromSortedLengths(lengths);
     stats.n50 = n50;
     stats.l50 = l50;
 
@@ -151,21 +245,7 @@ std::pair<size_t, size_t> computeN50L50(std::vector<size_t> lengths) {
     // Sort in descending order
     std::ranges::sort(lengths, std::greater{});
 
-    size_t total = std::accumulate(lengths.begin(), lengths.end(), size_t{0});
-    size_t half = total / 2;
-
-    size_t cumsum = 0;
-    size_t l50 = 0;
-
-    for (size_t len : lengths) {
-        cumsum += len;
-        l50++;
-        if (cumsum >= half) {
-            return {len, l50};
-        }
-    }
-
-    return {lengths.back(), lengths.size()};
+    return n50FromSortedLengths(lengths);
 }
 
 // ============================================================================
@@ -226,81 +306,109 @@ double shannonIndex(const KMerCounter& counter) {
 // Comparative Statistics
 // ============================================================================
 
-double jaccardSimilarity(const KMerCounter& counter1, const KMerCounter& counter2) {
-    if (counter1.empty() && counter2.empty()) return 1.0;
-    if (counter1.empty() || counter2.empty()) return 0.0;
-
-    std::set<std::string> set1, set2;
-
-    for (const auto& [kmer, count] : counter1) {
-        set1.insert(kmer);
+namespace {
+
+/**
+ * @brief Merge-join over two sorted profile entry arrays
+ *
+ * Calls fn(count1, count2) for every code present in either profile
+ * (the missing side's count is 0). Both arrays are walked once in
+ * ascending code order, so the whole join is sequential memory access.
+ */
+template<typename F>
+void joinProfiles(const KMerProfile& profile1, const KMerProfile& profile2, F&& fn) {
+    const auto& entries1 = profile1.entries();
+    const auto& entries2 = profile2.entries();
+
+    size_t i = 0;
+    size_t j = 0;
+
+    while (i < entries1.size() && j < entries2.size()) {
+        if (entries1[i].code < entries2[j].code) {
+            fn(entries1[i].count, size_t{0});
+            i++;
+        } else if (entries2[j].code < entries1[i].code) {
+            fn(size_t{0}, entries2[j].count);
+            j++;
+        } else {
+            fn(entries1[i].count, entries2[j].count);
+            i++;
+            j++;
+        }
+    }
+    for (; i < entries1.size(); ++i) {
+        fn(entries1[i].count, size_t{0});
     }
-    for (const auto& [kmer, count] : counter2) {
-        set2.insert(kmer);
+    for (; j < entries2.size(); ++j) {
+        fn(size_t{0}, entries2[j].count);
     }
+}
+
+} // anonymous namespace
+
+double jaccardSimilarity(const KMerProfile& profile1, const KMerProfile& profile2) {
+    if (profile1.empty() && profile2.empty()) return 1.0;
+    if (profile1.empty() || profile2.empty()) return 0.0;
 
     size_t intersection = 0;
-    for (const auto& kmer : set1) {
-        if (set2.count(kmer)) intersection++;
-    }
+    size_t union_size = 0;
+
+    joinProfiles(profile1, profile2, [&](size_t c1, size_t c2) {
+        union_size++;
+        if (c1 > 0 && c2 > 0) intersection++;
+    });
 
-    size_t union_size = set1.size() + set2.size() - intersection;
     return union_size > 0 ? static_cast<double>(intersection) / union_size : 0.0;
 }
 
-double cosineSimilarity(const KMerCounter& counter1, const KMerCounter& counter2) {
-    if (counter1.empty() || counter2.empty()) return 0.0;
-
-    // Get all k-mers
-    std::set<std::string> all_kmers;
-    for (const auto& [kmer, count] : counter1) {
-        all_kmers.insert(kmer);
-    }
-    for (const auto& [kmer, count] : counter2) {
-        all_kmers.insert(kmer);
-    }
+double cosineSimilarity(const KMerProfile& profile1, const KMerProfile& profile2) {
+    if (profile1.empty() || profile2.empty()) return 0.0;
 
     double dot_product = 0.0;
     double norm1 = 0.0;
     double norm2 = 0.0;
 
-    for (const auto& kmer : all_kmers) {
-        double c1 = static_cast<double>(counter1.getCount(kmer));
-        double c2 = static_cast<double>(counter2.getCount(kmer));
+    joinProfiles(profile1, profile2, [&](size_t count1, size_t count2) {
+        double c1 = static_cast<double>(count1);
+        double c2 = static_cast<double>(count2);
 
         dot_product += c1 * c2;
         norm1 += c1 * c1;
         norm2 += c2 * c2;
-    }
+    });
 
     double denom = std::sqrt(norm1) * std::sqrt(norm2);
     return denom > 0 ? dot_product / denom : 0.0;
 }
 
-double brayCurtisDissimilarity(const KMerCounter& counter1, const KMerCounter& counter2) {
-    if (counter1.empty() && counter2.empty()) return 0.0;
-
-    std::set<std::string> all_kmers;
-    for (const auto& [kmer, count] : counter1) {
-        all_kmers.insert(kmer);
-    }
-    for (const auto& [kmer, count] : counter2) {
-        all_kmers.insert(kmer);
-    }
+double brayCurtisDissimilarity(const KMerProfile& profile1, const KMerProfile& profile2) {
+    if (profile1.empty() && profile2.empty()) return 0.0;
 
     double sum_min = 0.0;
     double sum_total = 0.0;
 
-    for (const auto& kmer : all_kmers) {
-        double c1 = static_cast<double>(counter1.getCount(kmer));
-        double c2 = static_cast<double>(counter2.getCount(kmer));
+    joinProfiles(profile1, profile2, [&](size_t count1, size_t count2) {
+        double c1 = static_cast<double>(count1);
+        double c2 = static_cast<double>(count2);
 
         sum_min += std::min(c1, c2);
         sum_total += c1 + c2;
-    }
+    });
 
     return sum_total > 0 ? 1.0 - (2.0 * sum_min / sum_total) : 0.0;
 }
 
+double jaccardSimilarity(const KMerCounter& counter1, const KMerCounter& counter2) {
+    return jaccardSimilarity(KMerProfile(counter1), KMerProfile(counter2));
+}
+
+double cosineSimilarity(const KMerCounter& counter1, const KMerCounter& counter2) {
+    return cosineSimilarity(KMerProfile(counter1), KMerProfile(counter2));
+}
+
+double brayCurtisDissimilarity(const KMerCounter& counter1, const KMerCounter& counter2) {
+    return brayCurtisDissimilarity(KMerProfile(counter1), KMerProfile(counter2));
+}
+
 } // namespace stats
 } // namespace bioflow
@@ -0,0 +1,33 @@
+#include "bioflow/string_arena.hpp"
+#include "bioflow/instrument.hpp"
+#include <algorithm>
+
+namespace bioflow {
+
+StringArena::StringArena(size_t block_size)
+    : block_size_(std::max<size_t>(block_size, 1)) {}
+
+std::string_view StringArena::intern(std::string_view text) {
+    if (text.empty()) {
+        return {};
+    }
+
+    if (blocks_.empty() ||
+        blocks_.back().used + text.size() > blocks_.back().capacity) {
+        // Oversized strings get a block of their own rather than
+        // growing the regular block size
+        size_t capacity = std::max(block_size_, text.size());
+        blocks_.push_back({std::make_unique<char[]>(capacity), capacity, 0});
+        BIOFLOW_COUNT(arena_bytes_allocated, capacity);
+    }
+
+    Block& block = blocks_.back();
+    char* dest = block.data.get() + block.used;
+    std::memcpy(dest, text.data(), text.size());
+    block.used += text.size();
+    bytes_stored_ += text.size();
+
+    return {dest, text.size()};
+}
+
+} // namespace bioflow
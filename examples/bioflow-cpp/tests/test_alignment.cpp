@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "bioflow/alignment.hpp"
 
+#include <random>
+
 using namespace bioflow;
 
 // ============================================================================
@@ -98,6 +100,92 @@ TEST(SmithWatermanTest, LocalAlignment) {
     EXPECT_GE(result.matches, 3);
 }
 
+// ============================================================================
+// Striped Smith-Waterman Tests
+// ============================================================================
+
+TEST(StripedSmithWatermanTest, IdenticalSequences) {
+    Sequence seq1("ACGTACGTACGT");
+    Sequence seq2("ACGTACGTACGT");
+
+    auto result = smithWatermanSIMD(seq1, seq2);
+
+    EXPECT_EQ(result.score, 24);  // 12 matches * 2
+    EXPECT_EQ(result.matches, 12);
+    EXPECT_EQ(result.gaps, 0);
+}
+
+TEST(StripedSmithWatermanTest, MatchesScalarScore) {
+    Sequence seq1("ACGTACGTTACG");
+    Sequence seq2("TTACGTACCGTACGAA");
+
+    auto striped = smithWatermanSIMD(seq1, seq2);
+    auto scalar = smithWaterman(seq1, seq2);
+
+    EXPECT_EQ(striped.score, scalar.score);
+}
+
+TEST(StripedSmithWatermanTest, LocalAlignmentPositions) {
+    // The match lies in the middle of a longer target
+    Sequence seq1("ACGTACGT");
+    Sequence seq2("TTTTTTACGTACGTTTTTTT");
+
+    auto result = smithWatermanSIMD(seq1, seq2);
+
+    EXPECT_EQ(result.score, 16);
+    EXPECT_EQ(result.start2, 6);
+    EXPECT_EQ(result.end2, 13);
+}
+
+TEST(StripedSmithWatermanTest, SaturatesInto16BitLanes) {
+    // Score 2 * 400 = 800 overflows the 8-bit first pass
+    std::string bases;
+    std::mt19937 rng(13);
+    for (size_t i = 0; i < 400; ++i) {
+        bases += "ACGT"[rng() % 4];
+    }
+    Sequence seq1(bases);
+    Sequence seq2(bases);
+
+    auto result = smithWatermanSIMD(seq1, seq2);
+
+    EXPECT_EQ(result.score, 800);
+    EXPECT_EQ(result.matches, 400);
+}
+
+TEST(StripedSmithWatermanTest, RandomPairsMatchScalarOracle) {
+    std::mt19937 rng(17);
+    auto random_bases = [&](size_t length) {
+        std::string bases;
+        for (size_t i = 0; i < length; ++i) {
+            bases += "ACGT"[rng() % 4];
+        }
+        return bases;
+    };
+
+    for (int trial = 0; trial < 20; ++trial) {
+        Sequence seq1(random_bases(40 + rng() % 80));
+        Sequence seq2(random_bases(40 + rng() % 80));
+
+        auto striped = smithWatermanSIMD(seq1, seq2);
+        auto scalar = smithWaterman(seq1, seq2);
+
+        EXPECT_EQ(striped.score, scalar.score)
+            << seq1.bases() << " vs " << seq2.bases();
+    }
+}
+
+TEST(StripedSmithWatermanTest, NonDefaultScoring) {
+    Sequence seq1("ACGTTACGTA");
+    Sequence seq2("ACGATACGTT");
+
+    auto scoring = ScoringMatrix::strictMatch();
+    auto striped = smithWatermanSIMD(seq1, seq2, scoring);
+    auto scalar = smithWaterman(seq1, seq2, scoring);
+
+    EXPECT_EQ(striped.score, scalar.score);
+}
+
 // ============================================================================
 // Needleman-Wunsch Tests
 // ============================================================================
@@ -370,3 +458,577 @@ TEST(BandedAlignmentTest, FallsBackForDifferentLengths) {
 
     EXPECT_GT(result.score, 0);
 }
+
+// ============================================================================
+// Aligner (arena reuse) Tests
+// ============================================================================
+
+TEST(AlignerTest, MatchesFreeFunctions) {
+    Sequence seq1("ACGTACGTAC");
+    Sequence seq2("ACGTTCGTAC");
+
+    Aligner aligner;
+
+    auto local = aligner.smithWaterman(seq1, seq2);
+    auto global = aligner.needlemanWunsch(seq1, seq2);
+    auto fitting = aligner.semiGlobalAlignment(seq1, seq2);
+
+    EXPECT_EQ(local.score, smithWaterman(seq1, seq2).score);
+    EXPECT_EQ(global.score, needlemanWunsch(seq1, seq2).score);
+    EXPECT_EQ(fitting.score, semiGlobalAlignment(seq1, seq2).score);
+}
+
+TEST(AlignerTest, ArenaIsReusedAcrossCalls) {
+    std::mt19937 rng(99);
+    auto random_seq = [&](size_t length) {
+        static const char bases[] = "ACGT";
+        std::string s;
+        for (size_t i = 0; i < length; ++i) {
+            s += bases[rng() % 4];
+        }
+        return Sequence(s);
+    };
+
+    Aligner aligner;
+
+    // Largest problem first: subsequent smaller calls must not grow the arena
+    Sequence big1 = random_seq(300);
+    Sequence big2 = random_seq(300);
+    (void)aligner.needlemanWunsch(big1, big2);
+    size_t arena_bytes = aligner.arenaBytes();
+
+    for (size_t len = 50; len <= 300; len += 50) {
+        Sequence a = random_seq(len);
+        Sequence b = random_seq(len);
+        auto result = aligner.smithWaterman(a, b);
+        EXPECT_EQ(result.score, smithWaterman(a, b).score);
+        EXPECT_EQ(aligner.arenaBytes(), arena_bytes);
+    }
+}
+
+TEST(AlignerTest, CustomScoring) {
+    Sequence seq1("ACGT");
+    Sequence seq2("ACGT");
+
+    Aligner aligner(ScoringMatrix::strictMatch());
+    auto result = aligner.smithWaterman(seq1, seq2);
+
+    EXPECT_EQ(result.score, 4);  // 4 matches * 1
+    EXPECT_EQ(aligner.scoring().match_score, 1);
+}
+
+// ============================================================================
+// Linear-Space (Hirschberg) Alignment Tests
+// ============================================================================
+
+TEST(LinearSpaceAlignmentTest, IdenticalSequences) {
+    Sequence seq1("ACGTACGTACGT");
+    Sequence seq2("ACGTACGTACGT");
+
+    auto result = needlemanWunschLinear(seq1, seq2);
+
+    EXPECT_EQ(result.score, 24);  // 12 matches * 2
+    EXPECT_EQ(result.matches, 12u);
+    EXPECT_EQ(result.gaps, 0u);
+}
+
+TEST(LinearSpaceAlignmentTest, MatchesDirectDPScore) {
+    std::mt19937 rng(7);
+    auto random_seq = [&](size_t length) {
+        static const char bases[] = "ACGT";
+        std::string s;
+        for (size_t i = 0; i < length; ++i) {
+            s += bases[rng() % 4];
+        }
+        return Sequence(s);
+    };
+
+    for (int trial = 0; trial < 20; ++trial) {
+        Sequence seq1 = random_seq(20 + rng() % 180);
+        Sequence seq2 = random_seq(20 + rng() % 180);
+
+        auto linear = needlemanWunschLinear(seq1, seq2);
+        auto direct = needlemanWunsch(seq1, seq2);
+
+        EXPECT_EQ(linear.score, direct.score)
+            << "trial " << trial << ": " << seq1.bases()
+            << " vs " << seq2.bases();
+    }
+}
+
+TEST(LinearSpaceAlignmentTest, ReconstructsInputSequences) {
+    Sequence seq1("ACGTACTTAGCATGCA");
+    Sequence seq2("ACTACGTAGCAATGC");
+
+    auto result = needlemanWunschLinear(seq1, seq2);
+
+    std::string stripped1, stripped2;
+    for (char c : result.aligned_seq1) {
+        if (c != '-') stripped1 += c;
+    }
+    for (char c : result.aligned_seq2) {
+        if (c != '-') stripped2 += c;
+    }
+
+    EXPECT_EQ(stripped1, seq1.bases());
+    EXPECT_EQ(stripped2, seq2.bases());
+}
+
+TEST(LinearSpaceAlignmentTest, VeryDifferentLengths) {
+    Sequence seq1("ACGT");
+    Sequence seq2("TTTTACGTTTTT");
+
+    auto linear = needlemanWunschLinear(seq1, seq2);
+    auto direct = needlemanWunsch(seq1, seq2);
+
+    EXPECT_EQ(linear.score, direct.score);
+}
+
+TEST(LinearSpaceAlignmentTest, CustomScoring) {
+    Sequence seq1("ACGTTACGT");
+    Sequence seq2("ACGTACGT");
+
+    auto scoring = ScoringMatrix::strictMatch();
+    auto linear = needlemanWunschLinear(seq1, seq2, scoring);
+    auto direct = needlemanWunsch(seq1, seq2, scoring);
+
+    EXPECT_EQ(linear.score, direct.score);
+}
+
+// ============================================================================
+// BatchAligner Tests
+// ============================================================================
+
+TEST(BatchAlignerTest, EmptyInput) {
+    BatchAligner batch;
+    auto results = batch.alignAll({});
+    EXPECT_TRUE(results.empty());
+}
+
+TEST(BatchAlignerTest, MatchesPerPairFunctionsInOrder) {
+    std::mt19937 rng(11);
+    auto random_seq = [&](size_t length) {
+        static const char bases[] = "ACGT";
+        std::string s;
+        for (size_t i = 0; i < length; ++i) {
+            s += bases[rng() % 4];
+        }
+        return Sequence(s);
+    };
+
+    // Wildly varying sizes to exercise the stealing path
+    std::vector<std::pair<Sequence, Sequence>> pairs;
+    for (size_t i = 0; i < 40; ++i) {
+        size_t len1 = 10 + rng() % 300;
+        size_t len2 = 10 + rng() % 300;
+        pairs.emplace_back(random_seq(len1), random_seq(len2));
+    }
+
+    BatchAligner batch(ScoringMatrix{}, 4);
+    auto local = batch.alignAll(pairs, AlignmentMode::Local);
+    auto global = batch.alignAll(pairs, AlignmentMode::Global);
+    auto fitting = batch.alignAll(pairs, AlignmentMode::SemiGlobal);
+
+    ASSERT_EQ(local.size(), pairs.size());
+    for (size_t i = 0; i < pairs.size(); ++i) {
+        const auto& [first, second] = pairs[i];
+        EXPECT_EQ(local[i].score, smithWaterman(first, second).score) << i;
+        EXPECT_EQ(global[i].score, needlemanWunsch(first, second).score) << i;
+        EXPECT_EQ(fitting[i].score, semiGlobalAlignment(first, second).score) << i;
+    }
+}
+
+TEST(BatchAlignerTest, MoreThreadsThanPairs) {
+    std::vector<std::pair<Sequence, Sequence>> pairs;
+    pairs.emplace_back(Sequence("ACGT"), Sequence("ACGT"));
+    pairs.emplace_back(Sequence("TTTT"), Sequence("TTTA"));
+
+    BatchAligner batch(ScoringMatrix{}, 16);
+    auto results = batch.alignAll(pairs);
+
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results[0].score, 8);  // 4 matches * 2
+    EXPECT_EQ(results[1].score, smithWaterman(pairs[1].first, pairs[1].second).score);
+}
+
+TEST(BatchAlignerTest, CustomScoring) {
+    std::vector<std::pair<Sequence, Sequence>> pairs;
+    pairs.emplace_back(Sequence("ACGTACGT"), Sequence("ACGTACGT"));
+
+    BatchAligner batch(ScoringMatrix::strictMatch(), 2);
+    auto results = batch.alignAll(pairs, AlignmentMode::Global);
+
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].score, 8);  // 8 matches * 1
+    EXPECT_EQ(batch.scoring().match_score, 1);
+}
+
+// ============================================================================
+// Affine-Gap (Gotoh) Alignment Tests
+// ============================================================================
+
+TEST(AffineAlignmentTest, GlobalKeepsGapRunsTogether) {
+    Sequence seq1("AAATTTCCC", "s1");
+    Sequence seq2("AAACCC", "s2");
+
+    auto affine = needlemanWunschAffine(seq1, seq2);
+
+    // One 3-long gap: 6 matches * 2 + (-2 + 2 * -1)
+    EXPECT_EQ(affine.score, 8);
+    EXPECT_EQ(affine.aligned_seq1, "AAATTTCCC");
+    EXPECT_EQ(affine.aligned_seq2, "AAA---CCC");
+    EXPECT_EQ(affine.gaps, 3u);
+
+    // The linear DP pays gap_open per base, so the same alignment
+    // scores lower there
+    auto linear = needlemanWunsch(seq1, seq2);
+    EXPECT_GT(affine.score, linear.score);
+}
+
+TEST(AffineAlignmentTest, SingleBaseGapMatchesLinear) {
+    Sequence seq1("ACGT", "s1");
+    Sequence seq2("ACT", "s2");
+
+    // A length-1 gap costs gap_open in both models
+    EXPECT_EQ(needlemanWunschAffine(seq1, seq2).score,
+              needlemanWunsch(seq1, seq2).score);
+}
+
+TEST(AffineAlignmentTest, LocalBridgesLongGap) {
+    ScoringMatrix scoring{3, -2, -4, -1};
+    Sequence read("AAAAATTTTT", "read");
+    Sequence ref("AAAAACCCCCCTTTTT", "ref");
+
+    auto result = smithWatermanAffine(read, ref, scoring);
+
+    // Bridging the CCCCCC insert costs -4 + 5 * -1 = -9 against
+    // 10 matches * 3 = 30
+    EXPECT_EQ(result.score, 21);
+    EXPECT_EQ(result.matches, 10u);
+    EXPECT_EQ(result.gaps, 6u);
+}
+
+TEST(AffineAlignmentTest, ReducesToLinearWhenExtendEqualsOpen) {
+    // With gap_extend == gap_open every gap costs open * length, which
+    // is exactly the linear model
+    ScoringMatrix scoring{2, -1, -2, -2};
+
+    std::mt19937 rng(77);
+    std::uniform_int_distribution<int> base(0, 3);
+    const char bases[] = "ACGT";
+
+    for (int trial = 0; trial < 10; ++trial) {
+        std::string b1, b2;
+        for (int i = 0; i < 40; ++i) b1 += bases[base(rng)];
+        for (int i = 0; i < 35; ++i) b2 += bases[base(rng)];
+
+        Sequence seq1(b1, "s1");
+        Sequence seq2(b2, "s2");
+
+        EXPECT_EQ(needlemanWunschAffine(seq1, seq2, scoring).score,
+                  needlemanWunsch(seq1, seq2, scoring).score);
+        EXPECT_EQ(smithWatermanAffine(seq1, seq2, scoring).score,
+                  smithWaterman(seq1, seq2, scoring).score);
+    }
+}
+
+// ============================================================================
+// Banded Engine Tests
+// ============================================================================
+
+TEST(BandedEngineTest, TracebackRunsInsideTheBand) {
+    Sequence seq1("ACGTACGTACGT");
+    Sequence seq2("ACGTACCGTACGT");  // one inserted base
+
+    auto banded = bandedSmithWaterman(seq1, seq2, 4);
+    auto full = smithWaterman(seq1, seq2);
+
+    EXPECT_EQ(banded.score, full.score);
+    EXPECT_EQ(banded.matches, full.matches);
+    EXPECT_FALSE(banded.aligned_seq1.empty());
+    EXPECT_NE(banded.cigar().find('I'), std::string::npos);
+}
+
+TEST(BandedEngineTest, MatchesFullAlignmentAtLowDivergence) {
+    std::mt19937 rng(17);
+    std::string bases1;
+    for (size_t i = 0; i < 400; ++i) {
+        bases1 += "ACGT"[rng() % 4];
+    }
+    // ~2% substitutions, like a polished long read
+    std::string bases2 = bases1;
+    for (size_t i = 0; i < bases2.size(); i += 50) {
+        bases2[i] = bases2[i] == 'A' ? 'C' : 'A';
+    }
+
+    Sequence seq1(bases1);
+    Sequence seq2(bases2);
+
+    auto banded = bandedSmithWaterman(seq1, seq2, 16);
+    auto full = smithWaterman(seq1, seq2);
+    EXPECT_EQ(banded.score, full.score);
+}
+
+TEST(BandedEngineTest, AffineBandMatchesFullAffine) {
+    ScoringMatrix scoring{2, -1, -4, -1};
+    Sequence seq1("AAAATTTTCCCCGGGG");
+    Sequence seq2("AAAATTTTACGTCCCCGGGG");  // 4-base insertion
+
+    auto banded = bandedSmithWatermanAffine(seq1, seq2, 8, scoring);
+    auto full = smithWatermanAffine(seq1, seq2, scoring);
+
+    EXPECT_EQ(banded.score, full.score);
+    EXPECT_EQ(banded.gaps, full.gaps);
+}
+
+TEST(BandedEngineTest, AdaptiveBandGrowsToRecoverDriftingIndels) {
+    // An insertion and a matching deletion keep the lengths equal but
+    // push the optimal path 2 diagonals off-center, out of reach of a
+    // width-1 band; the adaptive variant widens until the drift fits
+    std::mt19937 rng(5);
+    std::string bases1;
+    for (size_t i = 0; i < 400; ++i) {
+        bases1 += "ACGT"[rng() % 4];
+    }
+    std::string bases2 = bases1;
+    bases2.insert(100, "AC");
+    bases2.erase(302, 2);
+
+    Sequence seq1(bases1);
+    Sequence seq2(bases2);
+    ScoringMatrix scoring{2, -4, -2, -1};  // gaps beat mismatch runs
+
+    auto narrow = bandedSmithWaterman(seq1, seq2, 1, scoring);
+    auto adaptive = adaptiveBandedSmithWaterman(seq1, seq2, 1, scoring);
+    auto full = smithWaterman(seq1, seq2, scoring);
+
+    EXPECT_LT(narrow.score, full.score);
+    EXPECT_EQ(adaptive.score, full.score);
+}
+
+TEST(BandedEngineTest, AdaptiveAffineMatchesFullAffine) {
+    std::mt19937 rng(6);
+    std::string bases1;
+    for (size_t i = 0; i < 300; ++i) {
+        bases1 += "ACGT"[rng() % 4];
+    }
+    std::string bases2 = bases1;
+    bases2.insert(80, "GG");
+    bases2.erase(222, 2);
+
+    Sequence seq1(bases1);
+    Sequence seq2(bases2);
+    ScoringMatrix scoring{2, -4, -5, -1};
+
+    auto adaptive = adaptiveBandedSmithWatermanAffine(seq1, seq2, 1, scoring);
+    auto full = smithWatermanAffine(seq1, seq2, scoring);
+    EXPECT_EQ(adaptive.score, full.score);
+}
+
+TEST(BandedEngineTest, NoAlignmentReturnsEmptyResult) {
+    Sequence seq1("AAAA");
+    Sequence seq2("CCCC");
+    ScoringMatrix scoring{1, -2, -3, -1};
+
+    auto result = bandedSmithWaterman(seq1, seq2, 2, scoring);
+    EXPECT_EQ(result.score, 0);
+    EXPECT_TRUE(result.aligned_seq1.empty());
+}
+
+// ============================================================================
+// Guide-Tree MSA Tests
+// ============================================================================
+
+namespace {
+
+std::string stripGaps(const std::string& row) {
+    std::string bases;
+    for (char c : row) {
+        if (c != '-') {
+            bases += c;
+        }
+    }
+    return bases;
+}
+
+} // anonymous namespace
+
+TEST(GuideTreeMSATest, RowsRecoverInputsInOrder) {
+    std::vector<Sequence> sequences;
+    sequences.emplace_back("ACGTACGTAAGGCC");
+    sequences.emplace_back("TTGCAGGCATTGCA");
+    sequences.emplace_back("ACGTACGTAGGCC");  // one deletion vs the first
+    sequences.emplace_back("TTGCAGGCTTGCA");  // one deletion vs the second
+
+    auto result = multipleAlignment(sequences);
+
+    ASSERT_EQ(result.size(), sequences.size());
+    for (size_t i = 1; i < result.size(); ++i) {
+        EXPECT_EQ(result[i].length(), result[0].length());
+    }
+    for (size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(stripGaps(result[i]), sequences[i].bases());
+    }
+}
+
+TEST(GuideTreeMSATest, IdenticalSequencesNeedNoGaps) {
+    std::vector<Sequence> sequences(5, Sequence("ACGTACGTACGT"));
+
+    auto result = multipleAlignment(sequences);
+
+    ASSERT_EQ(result.size(), 5u);
+    for (const auto& row : result) {
+        EXPECT_EQ(row, "ACGTACGTACGT");
+    }
+}
+
+TEST(GuideTreeMSATest, AmpliconClusterAlignsAcrossThreads) {
+    std::mt19937 rng(11);
+    std::string reference;
+    for (size_t i = 0; i < 120; ++i) {
+        reference += "ACGT"[rng() % 4];
+    }
+
+    std::vector<Sequence> sequences;
+    for (size_t v = 0; v < 12; ++v) {
+        std::string variant = reference;
+        variant[10 + v * 3] = "ACGT"[rng() % 4];    // substitution
+        if (v % 3 == 0) {
+            variant.insert(50 + v, 1, "ACGT"[rng() % 4]);
+        } else if (v % 3 == 1) {
+            variant.erase(70 + v, 1);
+        }
+        sequences.emplace_back(variant);
+    }
+
+    auto result = multipleAlignment(sequences, ScoringMatrix{}, 2);
+
+    ASSERT_EQ(result.size(), sequences.size());
+    for (size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(result[i].length(), result[0].length());
+        EXPECT_EQ(stripGaps(result[i]), sequences[i].bases());
+    }
+}
+
+// ============================================================================
+// Bit-Parallel Distance Tests
+// ============================================================================
+
+TEST(BitParallelDistanceTest, ShortPairsMatchNaiveOracle) {
+    std::mt19937 rng(23);
+    auto random_bases = [&](size_t length) {
+        std::string bases;
+        for (size_t i = 0; i < length; ++i) {
+            bases += "ACGT"[rng() % 4];
+        }
+        return bases;
+    };
+    auto naive = [](std::string_view s1, std::string_view s2) {
+        std::vector<size_t> prev(s2.size() + 1), curr(s2.size() + 1);
+        for (size_t j = 0; j <= s2.size(); ++j) prev[j] = j;
+        for (size_t i = 1; i <= s1.size(); ++i) {
+            curr[0] = i;
+            for (size_t j = 1; j <= s2.size(); ++j) {
+                curr[j] = (s1[i-1] == s2[j-1])
+                    ? prev[j-1]
+                    : 1 + std::min({prev[j-1], prev[j], curr[j-1]});
+            }
+            std::swap(prev, curr);
+        }
+        return prev[s2.size()];
+    };
+
+    for (int trial = 0; trial < 30; ++trial) {
+        std::string b1 = random_bases(1 + rng() % 64);
+        std::string b2 = random_bases(1 + rng() % 150);
+        EXPECT_EQ(editDistance(Sequence(b1), Sequence(b2)), naive(b1, b2))
+            << b1 << " vs " << b2;
+    }
+}
+
+TEST(BitParallelDistanceTest, FullWordPattern) {
+    std::mt19937 rng(29);
+    std::string bases;
+    for (size_t i = 0; i < 64; ++i) {
+        bases += "ACGT"[rng() % 4];
+    }
+    std::string mutated = bases;
+    mutated[10] = mutated[10] == 'A' ? 'C' : 'A';
+    mutated.erase(40, 1);
+
+    EXPECT_EQ(editDistance(Sequence(bases), Sequence(mutated)), 2u);
+}
+
+TEST(BoundedEditDistanceTest, ReturnsDistanceWithinBound) {
+    Sequence seq1("ACGTACGTACGTACGT");
+    Sequence seq2("ACGTACTTACGACGT");  // one substitution, one deletion
+
+    auto within = editDistanceWithin(seq1, seq2, 4);
+    ASSERT_TRUE(within.has_value());
+    EXPECT_EQ(*within, editDistance(seq1, seq2));
+}
+
+TEST(BoundedEditDistanceTest, RejectsAboveBound) {
+    Sequence seq1("AAAAAAAAAAAAAAAA");
+    Sequence seq2("TTTTTTTTTTTTTTTT");
+
+    EXPECT_FALSE(editDistanceWithin(seq1, seq2, 4).has_value());
+}
+
+TEST(BoundedEditDistanceTest, LengthDifferenceShortCircuits) {
+    Sequence seq1("ACGT");
+    Sequence seq2("ACGTACGTACGT");
+
+    EXPECT_FALSE(editDistanceWithin(seq1, seq2, 3).has_value());
+    auto within = editDistanceWithin(seq1, seq2, 8);
+    ASSERT_TRUE(within.has_value());
+    EXPECT_EQ(*within, 8u);
+}
+
+TEST(BoundedEditDistanceTest, AgreesWithUnboundedOnRandomReads) {
+    std::mt19937 rng(31);
+    auto random_bases = [&](size_t length) {
+        std::string bases;
+        for (size_t i = 0; i < length; ++i) {
+            bases += "ACGT"[rng() % 4];
+        }
+        return bases;
+    };
+
+    for (int trial = 0; trial < 20; ++trial) {
+        std::string b1 = random_bases(150);
+        std::string b2 = b1;
+        const size_t edits = rng() % 7;
+        for (size_t e = 0; e < edits; ++e) {
+            b2[rng() % b2.size()] = "ACGT"[rng() % 4];
+        }
+
+        Sequence seq1(b1);
+        Sequence seq2(b2);
+        const size_t exact = editDistance(seq1, seq2);
+        auto within = editDistanceWithin(seq1, seq2, 6);
+        if (exact <= 6) {
+            ASSERT_TRUE(within.has_value());
+            EXPECT_EQ(*within, exact);
+        } else {
+            EXPECT_FALSE(within.has_value());
+        }
+    }
+}
+
+TEST(HammingDistanceTest, SimdPathMatchesScalarOnLongReads) {
+    std::mt19937 rng(37);
+    std::string b1;
+    for (size_t i = 0; i < 151; ++i) {  // odd length exercises the tail loop
+        b1 += "ACGT"[rng() % 4];
+    }
+    std::string b2 = b1;
+    size_t expected = 0;
+    for (size_t i = 3; i < b2.size(); i += 17) {
+        char replacement = b2[i] == 'A' ? 'G' : 'A';
+        b2[i] = replacement;
+        ++expected;
+    }
+
+    EXPECT_EQ(hammingDistance(Sequence(b1), Sequence(b2)), expected);
+}
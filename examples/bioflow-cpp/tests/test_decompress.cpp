@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+#include "bioflow/decompress.hpp"
+#include <random>
+#include <string>
+
+using namespace bioflow;
+
+namespace {
+
+std::string randomBases(size_t length, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(0, 3);
+    static constexpr char kBases[] = "ACGT";
+    std::string out;
+    out.reserve(length);
+    for (size_t i = 0; i < length; ++i) {
+        out += kBases[dist(rng)];
+    }
+    return out;
+}
+
+std::string makeFastq(size_t records, size_t read_length, unsigned seed) {
+    std::string out;
+    for (size_t i = 0; i < records; ++i) {
+        out += "@read" + std::to_string(i) + "\n";
+        out += randomBases(read_length, seed + static_cast<unsigned>(i));
+        out += "\n+\n";
+        out += std::string(read_length, 'I');
+        out += "\n";
+    }
+    return out;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Format Detection
+// ============================================================================
+
+TEST(FormatDetectionTest, DistinguishesGzipBgzfAndPlain) {
+    std::string plain = "ACGTACGT";
+    std::string gz = compressGzip(plain);
+    std::string bgzf = compressBgzf(plain);
+
+    EXPECT_FALSE(isGzip(plain));
+    EXPECT_FALSE(isBgzf(plain));
+
+    EXPECT_TRUE(isGzip(gz));
+    EXPECT_FALSE(isBgzf(gz));
+
+    EXPECT_TRUE(isGzip(bgzf));  // BGZF is valid gzip too
+    EXPECT_TRUE(isBgzf(bgzf));
+}
+
+TEST(FormatDetectionTest, MakeDecompressorRejectsPlainData) {
+    EXPECT_THROW((void)makeDecompressor("not compressed"), IOError);
+}
+
+// ============================================================================
+// GzipDecompressor
+// ============================================================================
+
+TEST(GzipDecompressorTest, RoundTripsSingleMember) {
+    std::string original = randomBases(10000, 1);
+    std::string compressed = compressGzip(original);
+
+    GzipDecompressor codec;
+    std::string out(original.size(), '\0');
+    auto result = codec.decompress(compressed, out);
+
+    EXPECT_EQ(result.consumed, compressed.size());
+    EXPECT_EQ(result.produced, original.size());
+    EXPECT_TRUE(result.finished);
+    EXPECT_EQ(out, original);
+}
+
+TEST(GzipDecompressorTest, HandlesConcatenatedMembers) {
+    std::string first = randomBases(5000, 2);
+    std::string second = randomBases(3000, 3);
+    std::string compressed = compressGzip(first) + compressGzip(second);
+
+    GzipDecompressor codec;
+    std::string out(first.size() + second.size(), '\0');
+    auto result = codec.decompress(compressed, out);
+
+    EXPECT_TRUE(result.finished);
+    EXPECT_EQ(result.produced, out.size());
+    EXPECT_EQ(out, first + second);
+}
+
+TEST(GzipDecompressorTest, StreamsThroughSmallOutputWindow) {
+    std::string original = randomBases(20000, 4);
+    std::string compressed = compressGzip(original);
+
+    GzipDecompressor codec;
+    std::string out;
+    char window[256];
+    size_t pos = 0;
+    bool finished = false;
+    while (!finished) {
+        auto result = codec.decompress(
+            std::string_view(compressed).substr(pos), window);
+        pos += result.consumed;
+        out.append(window, result.produced);
+        finished = result.finished;
+        ASSERT_TRUE(result.produced > 0 || result.consumed > 0 || finished);
+    }
+
+    EXPECT_EQ(out, original);
+}
+
+TEST(GzipDecompressorTest, CorruptStreamThrows) {
+    std::string compressed = compressGzip(randomBases(1000, 5));
+    compressed[compressed.size() / 2] ^= 0x55;
+
+    GzipDecompressor codec;
+    std::string out(2000, '\0');
+    EXPECT_THROW((void)codec.decompress(compressed, out), IOError);
+}
+
+// ============================================================================
+// BGZF
+// ============================================================================
+
+TEST(BgzfTest, RoundTripsAcrossBlocks) {
+    std::string original = randomBases(200000, 6);
+    std::string compressed = compressBgzf(original, 4096);
+
+    EXPECT_EQ(decompressBgzfParallel(compressed), original);
+    EXPECT_EQ(decompressBgzfParallel(compressed, 3), original);
+    EXPECT_EQ(decompressBgzfParallel(compressed, 1), original);
+}
+
+TEST(BgzfTest, EmptyInputYieldsOnlyEofBlock) {
+    std::string compressed = compressBgzf("");
+    EXPECT_TRUE(isBgzf(compressed));
+    EXPECT_EQ(decompressBgzfParallel(compressed), "");
+}
+
+TEST(BgzfTest, PlainGzipIsRejected) {
+    std::string gz = compressGzip("ACGT");
+    EXPECT_THROW((void)decompressBgzfParallel(gz), IOError);
+}
+
+TEST(BgzfTest, TruncatedInputThrows) {
+    std::string compressed = compressBgzf(randomBases(50000, 7), 4096);
+    compressed.resize(compressed.size() / 2);
+    EXPECT_THROW((void)decompressBgzfParallel(compressed), IOError);
+}
+
+TEST(BgzfTest, StreamStillReadableByGzipCodec) {
+    // BGZF members are ordinary gzip members, so the streaming codec
+    // must read them too
+    std::string original = randomBases(30000, 8);
+    std::string compressed = compressBgzf(original, 4096);
+
+    GzipDecompressor codec;
+    // One spare byte so the empty EOF member can be consumed too
+    std::string out(original.size() + 1, '\0');
+    auto result = codec.decompress(compressed, out);
+    EXPECT_TRUE(result.finished);
+    EXPECT_EQ(out.substr(0, result.produced), original);
+}
+
+// ============================================================================
+// DecompressingReader
+// ============================================================================
+
+TEST(DecompressingReaderTest, ReadsGzipInChunks) {
+    std::string original = randomBases(100000, 9);
+    std::string compressed = compressGzip(original);
+
+    DecompressingReader reader(std::string_view(compressed), 8192);
+    EXPECT_EQ(reader.readAll(), original);
+}
+
+TEST(DecompressingReaderTest, ReadsBgzfInChunks) {
+    std::string original = randomBases(100000, 10);
+    std::string compressed = compressBgzf(original, 4096);
+
+    DecompressingReader reader(std::string_view(compressed), 16384);
+    EXPECT_EQ(reader.readAll(), original);
+}
+
+TEST(DecompressingReaderTest, PassesPlainDataThrough) {
+    std::string original = makeFastq(10, 50, 11);
+
+    DecompressingReader reader(std::string_view(original), 256);
+    EXPECT_EQ(reader.readAll(), original);
+}
+
+TEST(DecompressingReaderTest, CorruptStreamSurfacesInNextChunk) {
+    std::string compressed = compressGzip(randomBases(100000, 12));
+    compressed[compressed.size() - 10] ^= 0x55;
+
+    DecompressingReader reader(std::string_view(compressed), 4096);
+    std::string chunk;
+    EXPECT_THROW(while (reader.nextChunk(chunk)) {}, IOError);
+}
+
+// ============================================================================
+// CompressedFastqReader
+// ============================================================================
+
+TEST(CompressedFastqReaderTest, GzipMatchesPlainReader) {
+    std::string fastq = makeFastq(200, 80, 13);
+    std::string compressed = compressGzip(fastq);
+
+    auto expected = FastqReader(std::string_view(fastq)).readAll();
+
+    // Small chunks force records to straddle chunk boundaries
+    CompressedFastqReader reader{std::string_view(compressed)};
+    auto records = reader.readAll();
+
+    ASSERT_EQ(records.size(), expected.size());
+    for (size_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(records[i].id, expected[i].id);
+        EXPECT_EQ(records[i].bases, expected[i].bases);
+        EXPECT_EQ(records[i].quality.scores(), expected[i].quality.scores());
+    }
+}
+
+TEST(CompressedFastqReaderTest, BgzfMatchesPlainReader) {
+    std::string fastq = makeFastq(300, 60, 14);
+    std::string compressed = compressBgzf(fastq, 2048);
+
+    auto expected = FastqReader(std::string_view(fastq)).readAll();
+
+    CompressedFastqReader reader{std::string_view(compressed)};
+    auto records = reader.readAll();
+
+    ASSERT_EQ(records.size(), expected.size());
+    for (size_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(records[i].bases, expected[i].bases);
+    }
+}
+
+TEST(CompressedFastqReaderTest, ReadsPlainInputToo) {
+    std::string fastq = makeFastq(25, 40, 15);
+
+    CompressedFastqReader reader{std::string_view(fastq)};
+    size_t count = 0;
+    while (auto record = reader.next()) {
+        EXPECT_EQ(record->length(), 40u);
+        count++;
+    }
+    EXPECT_EQ(count, 25u);
+}
+
+TEST(CompressedFastqReaderTest, MissingTrailingNewlineStillParses) {
+    std::string fastq = makeFastq(3, 30, 16);
+    fastq.pop_back();  // drop the final '\n'
+    std::string compressed = compressGzip(fastq);
+
+    CompressedFastqReader reader{std::string_view(compressed)};
+    EXPECT_EQ(reader.readAll().size(), 3u);
+}
+
+TEST(CompressedFastqReaderTest, TruncatedRecordThrows) {
+    std::string fastq = makeFastq(3, 30, 17);
+    fastq.resize(fastq.size() - 20);  // cut into the last quality line
+    std::string compressed = compressGzip(fastq);
+
+    CompressedFastqReader reader{std::string_view(compressed)};
+    EXPECT_THROW(while (reader.next()) {}, IOError);
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "bioflow/instrument.hpp"
+
+#include "bioflow/alignment.hpp"
+#include "bioflow/kmer.hpp"
+
+using namespace bioflow;
+
+TEST(InstrumentTest, ReportListsEveryCounter) {
+    auto text = instrument::formatReport(instrument::Report{});
+
+    EXPECT_NE(text.find("bases_parsed"), std::string::npos);
+    EXPECT_NE(text.find("kmers_inserted"), std::string::npos);
+    EXPECT_NE(text.find("dp_cells_filled"), std::string::npos);
+    EXPECT_NE(text.find("bytes_decompressed"), std::string::npos);
+    EXPECT_NE(text.find("arena_bytes_allocated"), std::string::npos);
+}
+
+TEST(InstrumentTest, SnapshotIsZeroWhenCompiledOut) {
+    if (instrument::enabled()) {
+        GTEST_SKIP() << "instrumented build";
+    }
+
+    auto report = instrument::snapshot();
+    EXPECT_EQ(report.bases_parsed, 0u);
+    EXPECT_EQ(report.kmers_inserted, 0u);
+    EXPECT_EQ(report.dp_cells_filled, 0u);
+}
+
+#if defined(BIOFLOW_INSTRUMENT)
+
+TEST(InstrumentTest, HotPathsBumpCounters) {
+    instrument::reset();
+
+    EncodedKMerCounter counter(4);
+    counter.countRaw("ACGTACGT");  // 5 k-mers
+
+    Sequence seq1("ACGTACGT");
+    Sequence seq2("ACGTTCGT");
+    (void)smithWaterman(seq1, seq2);
+
+    auto report = instrument::snapshot();
+    EXPECT_EQ(report.kmers_inserted, 5u);
+    EXPECT_EQ(report.dp_cells_filled, 81u);  // (8+1) * (8+1)
+}
+
+#endif
@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+#include "bioflow/io.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+using namespace bioflow;
+
+namespace {
+
+// Writes content to a unique temp file and removes it on destruction
+class TempFile {
+public:
+    explicit TempFile(std::string_view content) {
+        path_ = (std::filesystem::temp_directory_path() /
+                 ("bioflow_io_test_" + std::to_string(counter_++))).string();
+        std::ofstream out(path_, std::ios::binary);
+        out << content;
+    }
+
+    ~TempFile() { std::filesystem::remove(path_); }
+
+    [[nodiscard]] const std::string& path() const noexcept { return path_; }
+
+private:
+    std::string path_;
+    static inline int counter_ = 0;
+};
+
+} // anonymous namespace
+
+// ============================================================================
+// Newline Scanning Tests
+// ============================================================================
+
+TEST(FindNewlineTest, FindsFirstNewline) {
+    EXPECT_EQ(findNewline("abc\ndef"), 3u);
+    EXPECT_EQ(findNewline("\nabc"), 0u);
+    EXPECT_EQ(findNewline("abc"), 3u);  // Not found: length
+    EXPECT_EQ(findNewline(""), 0u);
+}
+
+TEST(FindNewlineTest, RespectsFromOffset) {
+    std::string_view text = "a\nb\nc\n";
+    EXPECT_EQ(findNewline(text, 0), 1u);
+    EXPECT_EQ(findNewline(text, 2), 3u);
+    EXPECT_EQ(findNewline(text, 4), 5u);
+    EXPECT_EQ(findNewline(text, 6), 6u);
+}
+
+TEST(FindNewlineTest, CrossesVectorBoundaries) {
+    // Newline at every position across a few SIMD widths
+    for (size_t pos = 0; pos < 100; ++pos) {
+        std::string text(100, 'A');
+        text[pos] = '\n';
+        EXPECT_EQ(findNewline(text), pos) << "newline at " << pos;
+    }
+}
+
+// ============================================================================
+// MappedFile Tests
+// ============================================================================
+
+TEST(MappedFileTest, MapsContent) {
+    TempFile file("hello mapped world");
+    MappedFile mapped(file.path());
+
+    EXPECT_EQ(mapped.size(), 18u);
+    EXPECT_EQ(mapped.view(), "hello mapped world");
+}
+
+TEST(MappedFileTest, EmptyFile) {
+    TempFile file("");
+    MappedFile mapped(file.path());
+
+    EXPECT_TRUE(mapped.empty());
+    EXPECT_EQ(mapped.size(), 0u);
+}
+
+TEST(MappedFileTest, MissingFileThrows) {
+    EXPECT_THROW(MappedFile("/nonexistent/bioflow/file"), IOError);
+}
+
+TEST(MappedFileTest, MoveTransfersOwnership) {
+    TempFile file("movable");
+    MappedFile first(file.path());
+    MappedFile second(std::move(first));
+
+    EXPECT_EQ(second.view(), "movable");
+    EXPECT_EQ(first.data(), nullptr);
+}
+
+// ============================================================================
+// FASTA Reader Tests
+// ============================================================================
+
+TEST(FastaReaderTest, SingleRecord) {
+    FastaReader reader(std::string_view(">seq1 a test read\nACGTACGT\n"));
+
+    FastaRecord record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.id, "seq1");
+    EXPECT_EQ(record.description, "a test read");
+    EXPECT_EQ(record.bases(), "ACGTACGT");
+    EXPECT_FALSE(reader.next(record));
+}
+
+TEST(FastaReaderTest, MultiLineBases) {
+    FastaReader reader(std::string_view(">seq1\nACGT\nTTAA\nGG\n"));
+
+    FastaRecord record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.raw_bases, "ACGT\nTTAA\nGG");
+    EXPECT_EQ(record.bases(), "ACGTTTAAGG");
+}
+
+TEST(FastaReaderTest, MultipleRecords) {
+    FastaReader reader(std::string_view(
+        ">a\nACGT\n>b desc\nTTTT\nAAAA\n>c\nGG\n"));
+
+    FastaRecord record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.id, "a");
+    EXPECT_EQ(record.bases(), "ACGT");
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.id, "b");
+    EXPECT_EQ(record.description, "desc");
+    EXPECT_EQ(record.bases(), "TTTTAAAA");
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.id, "c");
+    EXPECT_EQ(record.bases(), "GG");
+
+    EXPECT_FALSE(reader.next(record));
+}
+
+TEST(FastaReaderTest, HandlesCrlfAndBlankLines) {
+    FastaReader reader(std::string_view(">a\r\nACGT\r\n\r\n>b\r\nTTTT\r\n"));
+
+    FastaRecord record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.id, "a");
+    EXPECT_EQ(record.bases(), "ACGT");
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.id, "b");
+    EXPECT_EQ(record.bases(), "TTTT");
+}
+
+TEST(FastaReaderTest, MissingHeaderThrows) {
+    FastaReader reader(std::string_view("ACGT\n"));
+
+    FastaRecord record;
+    EXPECT_THROW((void)reader.next(record), IOError);
+}
+
+TEST(FastaReaderTest, ReadsFromFile) {
+    TempFile file(">chr1 fragment\nACGTACGT\nTTAA\n>chr2\nGGCC\n");
+    FastaReader reader(file.path());
+
+    auto sequences = reader.readAll();
+    ASSERT_EQ(sequences.size(), 2u);
+    EXPECT_EQ(sequences[0].bases(), "ACGTACGTTTAA");
+    ASSERT_TRUE(sequences[0].id().has_value());
+    EXPECT_EQ(*sequences[0].id(), "chr1");
+    EXPECT_EQ(sequences[1].bases(), "GGCC");
+}
+
+TEST(FastaReaderTest, ResetRestarts) {
+    FastaReader reader(std::string_view(">a\nACGT\n"));
+
+    FastaRecord record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_FALSE(reader.next(record));
+
+    reader.reset();
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.id, "a");
+}
+
+// ============================================================================
+// FASTQ Reader Tests
+// ============================================================================
+
+TEST(FastqReaderTest, SingleRecord) {
+    FastqReader reader(std::string_view("@read1 lane1\nACGT\n+\nIIII\n"));
+
+    FastqRecord record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.id, "read1");
+    EXPECT_EQ(record.description, "lane1");
+    EXPECT_EQ(record.bases, "ACGT");
+    EXPECT_EQ(record.quality, "IIII");
+    EXPECT_FALSE(reader.next(record));
+}
+
+TEST(FastqReaderTest, RecordsAreZeroCopyViews) {
+    std::string input = "@r\nACGT\n+\nIIII\n";
+    FastqReader reader{std::string_view(input)};
+
+    FastqRecord record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_GE(record.bases.data(), input.data());
+    EXPECT_LT(record.bases.data(), input.data() + input.length());
+}
+
+TEST(FastqReaderTest, ConvertsToQualifiedSequence) {
+    FastqReader reader(std::string_view("@r1\nACGT\n+r1\n!I5+\n"));
+
+    FastqRecord record;
+    ASSERT_TRUE(reader.next(record));
+
+    auto qualified = record.toQualifiedSequence();
+    EXPECT_EQ(qualified.id, "r1");
+    EXPECT_EQ(qualified.bases, "ACGT");
+    ASSERT_EQ(qualified.quality.length(), 4u);
+    EXPECT_EQ(qualified.quality[0], 0);   // '!' = Q0 in Phred33
+    EXPECT_EQ(qualified.quality[1], 40);  // 'I' = Q40
+    EXPECT_TRUE(qualified.isValid());
+}
+
+TEST(FastqReaderTest, QualityLengthMismatchThrows) {
+    FastqReader reader(std::string_view("@r\nACGT\n+\nII\n"));
+
+    FastqRecord record;
+    EXPECT_THROW((void)reader.next(record), IOError);
+}
+
+TEST(FastqReaderTest, MissingSeparatorThrows) {
+    FastqReader reader(std::string_view("@r\nACGT\nIIII\n"));
+
+    FastqRecord record;
+    EXPECT_THROW((void)reader.next(record), IOError);
+}
+
+TEST(FastqReaderTest, ReadsFromFile) {
+    TempFile file("@r1\nACGT\n+\nIIII\n@r2 tile2\nTTAAGG\n+\nIIIIII\n");
+    FastqReader reader(file.path());
+
+    auto sequences = reader.readAll();
+    ASSERT_EQ(sequences.size(), 2u);
+    EXPECT_EQ(sequences[0].id, "r1");
+    EXPECT_EQ(sequences[0].bases, "ACGT");
+    EXPECT_EQ(sequences[1].id, "r2");
+    ASSERT_TRUE(sequences[1].description.has_value());
+    EXPECT_EQ(*sequences[1].description, "tile2");
+    EXPECT_EQ(sequences[1].length(), 6u);
+}
+
+TEST(FastqReaderTest, ArenaConversionBorrowsIds) {
+    FastqReader reader(std::string_view("@r1 lane1\nACGT\n+\nIIII\n"));
+
+    FastqRecord record;
+    ASSERT_TRUE(reader.next(record));
+
+    StringArena ids;
+    auto qualified = record.toQualifiedSequence(QualityEncoding::Phred33, ids);
+    EXPECT_EQ(qualified.id, "r1");
+    EXPECT_TRUE(qualified.id.isBorrowed());
+    ASSERT_TRUE(qualified.description.has_value());
+    EXPECT_EQ(*qualified.description, "lane1");
+    EXPECT_TRUE(qualified.description->isBorrowed());
+    EXPECT_EQ(ids.bytesStored(), 7u);  // "r1" + "lane1"
+}
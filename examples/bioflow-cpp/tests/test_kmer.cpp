@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 #include "bioflow/kmer.hpp"
+#include "bioflow/alignment.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
 
 using namespace bioflow;
 
@@ -207,6 +214,178 @@ TEST(KMerCounterTest, Iteration) {
     EXPECT_EQ(count, counter.uniqueCount());
 }
 
+// ============================================================================
+// Encoded K-mer Tests
+// ============================================================================
+
+TEST(EncodedKMerTest, EncodeDecodeRoundTrip) {
+    EXPECT_EQ(decodeKmer(encodeKmer("ACGT"), 4), "ACGT");
+    EXPECT_EQ(decodeKmer(encodeKmer("TTTT"), 4), "TTTT");
+    EXPECT_EQ(decodeKmer(encodeKmer("AAAA"), 4), "AAAA");
+
+    std::string k32 = "ACGTACGTACGTACGTACGTACGTACGTACGT";
+    EXPECT_EQ(decodeKmer(encodeKmer(k32), 32), k32);
+}
+
+TEST(EncodedKMerTest, EncodingPreservesLexicographicOrder) {
+    EXPECT_LT(encodeKmer("AAA"), encodeKmer("AAC"));
+    EXPECT_LT(encodeKmer("ACG"), encodeKmer("CAA"));
+    EXPECT_LT(encodeKmer("GTT"), encodeKmer("TAA"));
+}
+
+TEST(EncodedKMerTest, EncodeThrowsAbove32) {
+    std::string k33(33, 'A');
+    EXPECT_THROW(encodeKmer(k33), KMerError);
+}
+
+TEST(EncodedKMerCounterTest, ConstructorValidatesK) {
+    EXPECT_NO_THROW(EncodedKMerCounter(1));
+    EXPECT_NO_THROW(EncodedKMerCounter(32));
+    EXPECT_THROW(EncodedKMerCounter(0), KMerError);
+    EXPECT_THROW(EncodedKMerCounter(33), KMerError);
+}
+
+TEST(EncodedKMerCounterTest, MatchesStringCounter) {
+    Sequence seq("ATCGATCGATCGAATTCCGGATCGNNATCGATCG");
+
+    KMerCounter reference(3);
+    reference.count(seq);
+
+    EncodedKMerCounter counter(3);
+    counter.count(seq);
+
+    EXPECT_EQ(counter.uniqueCount(), reference.uniqueCount());
+    EXPECT_EQ(counter.totalCount(), reference.totalCount());
+
+    for (const auto& [kmer, count] : reference) {
+        EXPECT_EQ(counter.getCount(kmer), count) << "k-mer " << kmer;
+    }
+}
+
+TEST(EncodedKMerCounterTest, SkipsWindowsContainingN) {
+    EncodedKMerCounter counter(3);
+    counter.countRaw("ACGNACG");
+
+    // Only ACG (twice) is N-free
+    EXPECT_EQ(counter.getCount("ACG"), 2);
+    EXPECT_EQ(counter.totalCount(), 2);
+    EXPECT_EQ(counter.getCount("GNA"), 0);
+}
+
+TEST(EncodedKMerCounterTest, MostFrequent) {
+    EncodedKMerCounter counter(2);
+    counter.countRaw("AAAAAACG");  // AA x5, AC x1, CG x1
+
+    auto top = counter.mostFrequent(1);
+    ASSERT_EQ(top.size(), 1);
+    EXPECT_EQ(top[0].kmer, "AA");
+    EXPECT_EQ(top[0].count, 5);
+}
+
+TEST(EncodedKMerCounterTest, Spectrum) {
+    EncodedKMerCounter counter(2);
+    counter.countRaw("AAAACG");
+
+    auto spec = counter.spectrum();
+    EXPECT_EQ(spec.k, 2);
+    EXPECT_EQ(spec.unique_kmers, 3);    // AA, AC, CG
+    EXPECT_EQ(spec.total_kmers, 5);
+    EXPECT_EQ(spec.singleton_count, 2); // AC, CG
+}
+
+TEST(EncodedKMerCounterTest, Merge) {
+    EncodedKMerCounter counter1(2);
+    counter1.countRaw("AAA");
+
+    EncodedKMerCounter counter2(2);
+    counter2.countRaw("AACC");
+
+    counter1.merge(counter2);
+    EXPECT_EQ(counter1.getCount("AA"), 3);
+    EXPECT_EQ(counter1.getCount("CC"), 1);
+
+    EncodedKMerCounter different(3);
+    EXPECT_THROW(counter1.merge(different), KMerError);
+}
+
+TEST(EncodedKMerCounterTest, TableGrowsBeyondInitialCapacity) {
+    // Distinct 10-mers from a long random-ish sequence force several
+    // rounds of rehashing past the initial table size
+    std::string bases;
+    std::mt19937 rng(7);
+    for (size_t i = 0; i < 20000; ++i) {
+        bases += "ACGT"[rng() % 4];
+    }
+
+    KMerCounter reference(10);
+    reference.countRaw(bases);
+
+    EncodedKMerCounter counter(10);
+    counter.countRaw(bases);
+
+    EXPECT_EQ(counter.uniqueCount(), reference.uniqueCount());
+    EXPECT_EQ(counter.totalCount(), reference.totalCount());
+}
+
+// ============================================================================
+// Parallel K-mer Tests
+// ============================================================================
+
+TEST(ParallelKMerCounterTest, MatchesSequentialCounter) {
+    std::vector<Sequence> sequences;
+    std::mt19937 rng(11);
+    for (size_t i = 0; i < 50; ++i) {
+        std::string bases;
+        for (size_t j = 0; j < 500; ++j) {
+            bases += "ACGT"[rng() % 4];
+        }
+        sequences.emplace_back(bases);
+    }
+
+    EncodedKMerCounter reference(7);
+    reference.countAll(sequences);
+
+    ParallelKMerCounter counter(7, 4);
+    counter.countAll(sequences);
+
+    EXPECT_EQ(counter.uniqueCount(), reference.uniqueCount());
+    EXPECT_EQ(counter.totalCount(), reference.totalCount());
+
+    for (const auto& entry : reference.allKmers()) {
+        EXPECT_EQ(counter.getCount(entry.kmer), entry.count)
+            << "k-mer " << entry.kmer;
+    }
+}
+
+TEST(ParallelKMerCounterTest, MoreThreadsThanSequences) {
+    std::vector<Sequence> sequences;
+    sequences.emplace_back("ACGTACGT");
+
+    ParallelKMerCounter counter(3, 8);
+    counter.countAll(sequences);
+
+    EXPECT_EQ(counter.getCount("ACG"), 2);
+    EXPECT_EQ(counter.totalCount(), 6);
+}
+
+TEST(ParallelKMerCounterTest, SpectrumAggregatesShards) {
+    std::vector<Sequence> sequences;
+    sequences.emplace_back("AAAACG");
+
+    ParallelKMerCounter counter(2, 2);
+    counter.countAll(sequences);
+
+    auto spec = counter.spectrum();
+    EXPECT_EQ(spec.unique_kmers, 3);
+    EXPECT_EQ(spec.total_kmers, 5);
+    EXPECT_EQ(spec.singleton_count, 2);
+}
+
+TEST(ParallelKMerCounterTest, ConstructorValidatesK) {
+    EXPECT_THROW(ParallelKMerCounter(0, 2), KMerError);
+    EXPECT_THROW(ParallelKMerCounter(33, 2), KMerError);
+}
+
 // ============================================================================
 // Canonical K-mer Tests
 // ============================================================================
@@ -238,6 +417,75 @@ TEST(CanonicalKMerCounterTest, CountCanonical) {
     EXPECT_GT(counter.totalCount(), 0);
 }
 
+TEST(CanonicalKMerCounterTest, StrandsShareOneCanonicalCount) {
+    CanonicalKMerCounter counter(3);
+    Sequence seq("ACGTT");  // ACG, CGT, GTT
+    counter.count(seq);
+
+    // ACG's RC is CGT: both windows land on the same canonical ACG
+    EXPECT_EQ(counter.getCount("ACG"), 2);
+    EXPECT_EQ(counter.getCount("CGT"), 2);
+
+    // GTT queried via either strand (RC: AAC)
+    EXPECT_EQ(counter.getCount("GTT"), 1);
+    EXPECT_EQ(counter.getCount("AAC"), 1);
+
+    EXPECT_EQ(counter.totalCount(), 3);
+    EXPECT_EQ(counter.uniqueCount(), 2);
+}
+
+TEST(CanonicalKMerCounterTest, MatchesStringOracle) {
+    std::mt19937 rng(321);
+    std::string bases;
+    static const char alphabet[] = "ACGT";
+    for (size_t i = 0; i < 5000; ++i) {
+        bases += alphabet[rng() % 4];
+    }
+    Sequence seq(bases);
+
+    const size_t k = 7;
+    CanonicalKMerCounter counter(k);
+    counter.count(seq);
+
+    // String-based canonical counting as the oracle
+    std::unordered_map<std::string, size_t> oracle;
+    for (size_t i = 0; i + k <= bases.length(); ++i) {
+        oracle[canonicalKmer(bases.substr(i, k))]++;
+    }
+
+    size_t oracle_total = 0;
+    for (const auto& [kmer, count] : oracle) {
+        EXPECT_EQ(counter.getCount(kmer), count) << kmer;
+        oracle_total += count;
+    }
+    EXPECT_EQ(counter.uniqueCount(), oracle.size());
+    EXPECT_EQ(counter.totalCount(), oracle_total);
+}
+
+TEST(CanonicalKMerCounterTest, SkipsWindowsWithN) {
+    CanonicalKMerCounter counter(3);
+    Sequence seq("ACNGT");
+    counter.count(seq);
+
+    EXPECT_EQ(counter.totalCount(), 0);
+    EXPECT_EQ(counter.getCount("ACN"), 0);
+}
+
+TEST(CanonicalKMerCounterTest, MostFrequentReportsCanonicalForm) {
+    CanonicalKMerCounter counter(3);
+    counter.count(Sequence("AAACCC"));
+    counter.count(Sequence("GGGTTT"));  // RC of AAACCC
+
+    auto top = counter.mostFrequent(1);
+    ASSERT_EQ(top.size(), 1u);
+    EXPECT_EQ(top[0].count, 2u);
+}
+
+TEST(CanonicalKMerCounterTest, InvalidKThrows) {
+    EXPECT_THROW(CanonicalKMerCounter(0), KMerError);
+    EXPECT_THROW(CanonicalKMerCounter(33), KMerError);
+}
+
 // ============================================================================
 // K-mer Entry Tests
 // ============================================================================
@@ -255,3 +503,626 @@ TEST(KMerEntryTest, Comparison) {
     EXPECT_TRUE(entry1 < entry2);
     EXPECT_TRUE(entry2 > entry1);
 }
+
+// ============================================================================
+// Minimizer Tests
+// ============================================================================
+
+TEST(MinimizerTest, CoversEveryWindow) {
+    std::mt19937 rng(55);
+    std::string bases;
+    static const char alphabet[] = "ACGT";
+    for (size_t i = 0; i < 2000; ++i) {
+        bases += alphabet[rng() % 4];
+    }
+
+    const size_t k = 9, w = 5;
+    auto minimizers = computeMinimizers(bases, k, w);
+    ASSERT_FALSE(minimizers.empty());
+
+    // Every window of w consecutive k-mers must contain a minimizer
+    size_t num_kmers = bases.length() - k + 1;
+    size_t idx = 0;
+    for (size_t window_start = 0; window_start + w <= num_kmers; ++window_start) {
+        while (idx < minimizers.size() &&
+               minimizers[idx].position < window_start) {
+            ++idx;
+        }
+        ASSERT_LT(idx, minimizers.size());
+        EXPECT_LT(minimizers[idx].position, window_start + w)
+            << "window at " << window_start;
+    }
+}
+
+TEST(MinimizerTest, PositionsMatchCodes) {
+    std::string bases = "ACGTACGTTAGCATCGGATC";
+    const size_t k = 5, w = 3;
+
+    for (const auto& minimizer : computeMinimizers(bases, k, w)) {
+        std::string kmer = bases.substr(minimizer.position, k);
+        uint64_t canonical = std::min(encodeKmer(kmer),
+                                      encodeKmer(canonicalKmer(kmer)));
+        EXPECT_EQ(minimizer.code, canonical) << kmer;
+    }
+}
+
+TEST(MinimizerTest, NRestartsScan) {
+    auto minimizers = computeMinimizers("ACGTNACGT", 3, 2);
+    for (const auto& minimizer : minimizers) {
+        // No minimizer may span the N at position 4
+        EXPECT_TRUE(minimizer.position + 3 <= 4 || minimizer.position > 4);
+    }
+}
+
+TEST(MinimizerTest, InvalidParametersThrow) {
+    EXPECT_THROW(computeMinimizers("ACGT", 0, 3), KMerError);
+    EXPECT_THROW(computeMinimizers("ACGT", 33, 3), KMerError);
+    EXPECT_THROW(computeMinimizers("ACGT", 3, 0), KMerError);
+}
+
+// ============================================================================
+// MinimizerIndex Tests
+// ============================================================================
+
+TEST(MinimizerIndexTest, FindsTrueLocation) {
+    std::mt19937 rng(77);
+    std::string reference;
+    static const char alphabet[] = "ACGT";
+    for (size_t i = 0; i < 10000; ++i) {
+        reference += alphabet[rng() % 4];
+    }
+
+    MinimizerIndex index(15, 10);
+    index.build(Sequence(reference));
+    EXPECT_GT(index.uniqueMinimizers(), 0u);
+    EXPECT_EQ(index.referenceLength(), reference.length());
+
+    // A read lifted straight out of the reference must produce a
+    // candidate region containing its true location
+    const size_t true_start = 6200, read_len = 150;
+    Sequence read(reference.substr(true_start, read_len));
+
+    auto regions = index.findCandidates(read);
+    ASSERT_FALSE(regions.empty());
+    EXPECT_LE(regions[0].start, true_start);
+    EXPECT_GE(regions[0].end, true_start + read_len);
+
+    // The top region is a small window, not the whole reference
+    EXPECT_LT(regions[0].end - regions[0].start, 4 * read_len);
+}
+
+TEST(MinimizerIndexTest, SeedAndExtendWithBandedAlignment) {
+    std::mt19937 rng(88);
+    std::string reference;
+    static const char alphabet[] = "ACGT";
+    for (size_t i = 0; i < 5000; ++i) {
+        reference += alphabet[rng() % 4];
+    }
+    Sequence ref_seq(reference);
+
+    MinimizerIndex index(13, 8);
+    index.build(ref_seq);
+
+    // Read with one mismatch relative to the reference
+    std::string read_bases = reference.substr(3000, 120);
+    read_bases[60] = (read_bases[60] == 'A') ? 'C' : 'A';
+    Sequence read(read_bases);
+
+    auto regions = index.findCandidates(read);
+    ASSERT_FALSE(regions.empty());
+
+    auto window = ref_seq.subsequence(
+        regions[0].start, regions[0].end - regions[0].start);
+    auto alignment = bandedSmithWaterman(read, window, 16);
+
+    // 119 matches, 1 mismatch under default scoring
+    EXPECT_EQ(alignment.score, 119 * 2 - 1);
+}
+
+TEST(MinimizerIndexTest, UnrelatedReadYieldsNoCandidates) {
+    std::mt19937 rng(99);
+    std::string reference, read;
+    static const char alphabet[] = "ACGT";
+    for (size_t i = 0; i < 3000; ++i) {
+        reference += alphabet[rng() % 4];
+    }
+    for (size_t i = 0; i < 100; ++i) {
+        read += alphabet[rng() % 4];
+    }
+
+    MinimizerIndex index(17, 10);
+    index.build(Sequence(reference));
+
+    auto regions = index.findCandidates(Sequence(read));
+    EXPECT_TRUE(regions.empty());
+}
+
+TEST(MinimizerIndexTest, RebuildReplacesContents) {
+    MinimizerIndex index(5, 3);
+    index.build(Sequence("ACGTACGTACGTACGTACGT"));
+    size_t first_count = index.uniqueMinimizers();
+    ASSERT_GT(first_count, 0u);
+
+    index.build(Sequence("TTTTTTTTTTTT"));
+    EXPECT_EQ(index.referenceLength(), 12u);
+    EXPECT_LE(index.uniqueMinimizers(), first_count);
+}
+
+// ============================================================================
+// Count-Min Sketch Tests
+// ============================================================================
+
+TEST(CountMinSketchTest, NeverUndercounts) {
+    CountMinSketch sketch(12);
+
+    for (size_t i = 0; i < 7; ++i) {
+        sketch.add(42);
+    }
+    EXPECT_GE(sketch.estimate(42), 7u);
+    EXPECT_EQ(sketch.estimate(43), 0u);
+}
+
+TEST(CountMinSketchTest, AddReturnsRunningEstimate) {
+    CountMinSketch sketch(12);
+
+    EXPECT_EQ(sketch.add(7), 1u);
+    EXPECT_EQ(sketch.add(7), 2u);
+    EXPECT_EQ(sketch.add(7), 3u);
+}
+
+TEST(CountMinSketchTest, ClearResets) {
+    CountMinSketch sketch(10);
+    sketch.add(1);
+    sketch.clear();
+    EXPECT_EQ(sketch.estimate(1), 0u);
+}
+
+TEST(CountMinSketchTest, InvalidParametersThrow) {
+    EXPECT_THROW(CountMinSketch(0), KMerError);
+    EXPECT_THROW(CountMinSketch(12, 0), KMerError);
+}
+
+// ============================================================================
+// Prefiltered K-mer Counter Tests
+// ============================================================================
+
+TEST(PrefilteredKMerCounterTest, SingletonsStayOutOfExactTable) {
+    PrefilteredKMerCounter counter(5, 2, 16);
+    counter.count(Sequence("AAACCCGGG"));  // Every 5-mer occurs once
+
+    EXPECT_EQ(counter.uniqueCount(), 0u);
+    EXPECT_EQ(counter.getCount("AAACC"), 0u);
+    EXPECT_EQ(counter.totalCount(), 5u);
+
+    auto spec = counter.spectrum();
+    EXPECT_EQ(spec.singleton_count, 5u);
+    EXPECT_EQ(spec.unique_kmers, 5u);
+}
+
+TEST(PrefilteredKMerCounterTest, RepeatedKmersGetExactCounts) {
+    PrefilteredKMerCounter counter(3, 2, 16);
+    KMerCounter oracle(3);
+
+    Sequence seq("ATCGATCGATCGATTTATCG");
+    counter.count(seq);
+    oracle.count(seq);
+
+    for (const auto& [kmer, count] : oracle) {
+        if (count >= 2) {
+            EXPECT_EQ(counter.getCount(kmer), count) << kmer;
+        } else {
+            EXPECT_EQ(counter.getCount(kmer), 0u) << kmer;
+        }
+    }
+    EXPECT_EQ(counter.totalCount(), oracle.totalCount());
+}
+
+TEST(PrefilteredKMerCounterTest, SpectrumMatchesExactCounting) {
+    std::mt19937 rng(222);
+    std::string bases;
+    static const char alphabet[] = "ACGT";
+    for (size_t i = 0; i < 20000; ++i) {
+        bases += alphabet[rng() % 4];
+    }
+    Sequence seq(bases);
+
+    const size_t k = 11;  // Long enough that most 11-mers are singletons
+    PrefilteredKMerCounter counter(k, 2, 20);
+    KMerCounter oracle(k);
+    counter.count(seq);
+    oracle.count(seq);
+
+    auto estimated = counter.spectrum();
+    auto exact = oracle.spectrum();
+
+    EXPECT_EQ(estimated.total_kmers, exact.total_kmers);
+
+    // A 2^20-cell sketch over ~20k k-mers has essentially no
+    // collisions, so the estimates should land on the exact values
+    EXPECT_NEAR(static_cast<double>(estimated.singleton_count),
+                static_cast<double>(exact.singleton_count),
+                exact.singleton_count * 0.01 + 1);
+    EXPECT_NEAR(static_cast<double>(estimated.unique_kmers),
+                static_cast<double>(exact.unique_kmers),
+                exact.unique_kmers * 0.01 + 1);
+
+    // Exact table only holds the repeated minority
+    EXPECT_LT(counter.uniqueCount(), exact.unique_kmers / 2);
+}
+
+TEST(PrefilteredKMerCounterTest, ThresholdOneBypassesSketch) {
+    PrefilteredKMerCounter counter(3, 1, 12);
+    counter.count(Sequence("ATCGATCG"));
+
+    EXPECT_EQ(counter.getCount("ATC"), 2u);
+    EXPECT_EQ(counter.getCount("GAT"), 1u);
+}
+
+TEST(PrefilteredKMerCounterTest, HigherThreshold) {
+    PrefilteredKMerCounter counter(2, 3, 12);
+    counter.count(Sequence("ATATATAT"));  // AT x4, TA x3
+
+    EXPECT_EQ(counter.getCount("AT"), 4u);
+    EXPECT_EQ(counter.getCount("TA"), 3u);
+    EXPECT_EQ(counter.getCount("CG"), 0u);
+}
+
+TEST(PrefilteredKMerCounterTest, ClearResets) {
+    PrefilteredKMerCounter counter(3, 2, 12);
+    counter.count(Sequence("ATCGATCG"));
+    ASSERT_GT(counter.totalCount(), 0u);
+
+    counter.clear();
+    EXPECT_EQ(counter.totalCount(), 0u);
+    EXPECT_EQ(counter.uniqueCount(), 0u);
+    EXPECT_EQ(counter.spectrum().singleton_count, 0u);
+}
+
+TEST(PrefilteredKMerCounterTest, InvalidParametersThrow) {
+    EXPECT_THROW(PrefilteredKMerCounter(0), KMerError);
+    EXPECT_THROW(PrefilteredKMerCounter(33), KMerError);
+    EXPECT_THROW(PrefilteredKMerCounter(5, 0), KMerError);
+}
+
+// ============================================================================
+// KMerProfile Tests
+// ============================================================================
+
+TEST(KMerProfileTest, SnapshotMatchesSourceCounter) {
+    KMerCounter counter(3);
+    counter.countRaw("ACGTACGTAC");
+
+    KMerProfile profile(counter);
+
+    EXPECT_EQ(profile.k(), 3u);
+    EXPECT_EQ(profile.uniqueCount(), counter.uniqueCount());
+    EXPECT_EQ(profile.totalCount(), counter.totalCount());
+    for (const auto& [kmer, count] : counter) {
+        EXPECT_EQ(profile.getCount(kmer), count);
+    }
+}
+
+TEST(KMerProfileTest, EntriesSortedByCode) {
+    EncodedKMerCounter counter(4);
+    counter.countRaw("GGGGCCCCAAAATTTTACGT");
+
+    KMerProfile profile(counter);
+
+    const auto& entries = profile.entries();
+    ASSERT_FALSE(entries.empty());
+    for (size_t i = 1; i < entries.size(); ++i) {
+        EXPECT_LT(entries[i - 1].code, entries[i].code);
+    }
+}
+
+TEST(KMerProfileTest, EncodedAndStringCountersAgree) {
+    const std::string bases = "ACGTTGCAACGTGGCATTAG";
+
+    KMerCounter string_counter(5);
+    string_counter.countRaw(bases);
+
+    EncodedKMerCounter encoded_counter(5);
+    encoded_counter.countRaw(bases);
+
+    KMerProfile from_string(string_counter);
+    KMerProfile from_encoded(encoded_counter);
+
+    ASSERT_EQ(from_string.uniqueCount(), from_encoded.uniqueCount());
+    EXPECT_EQ(from_string.totalCount(), from_encoded.totalCount());
+    for (size_t i = 0; i < from_string.entries().size(); ++i) {
+        EXPECT_EQ(from_string.entries()[i].code, from_encoded.entries()[i].code);
+        EXPECT_EQ(from_string.entries()[i].count, from_encoded.entries()[i].count);
+    }
+}
+
+TEST(KMerProfileTest, MissingKmerReturnsZero) {
+    KMerCounter counter(3);
+    counter.countRaw("AAAA");
+
+    KMerProfile profile(counter);
+
+    EXPECT_EQ(profile.getCount("AAA"), 2u);
+    EXPECT_EQ(profile.getCount("CCC"), 0u);
+    EXPECT_THROW((void)profile.getCount("AAAA"), KMerError);
+}
+
+TEST(KMerProfileTest, CanonicalCounterSnapshot) {
+    CanonicalKMerCounter counter(3);
+    counter.count(Sequence("ACGTTT", "read"));
+
+    KMerProfile profile(counter);
+
+    EXPECT_EQ(profile.totalCount(), counter.totalCount());
+    EXPECT_EQ(profile.uniqueCount(), counter.uniqueCount());
+}
+
+// ============================================================================
+// Binary Serialization Tests
+// ============================================================================
+
+namespace {
+
+std::filesystem::path tempProfilePath(const char* tag) {
+    return std::filesystem::temp_directory_path() /
+           (std::string("bioflow_kmer_") + tag + ".bfkp");
+}
+
+} // namespace
+
+TEST(KMerSerializationTest, ProfileRoundTrip) {
+    KMerCounter counter(4);
+    counter.countRaw("ACGTACGTTTGGCCAACGT");
+
+    KMerProfile original(counter);
+    auto path = tempProfilePath("profile");
+    original.save(path);
+
+    KMerProfile loaded = KMerProfile::load(path);
+
+    EXPECT_EQ(loaded.k(), original.k());
+    EXPECT_EQ(loaded.totalCount(), original.totalCount());
+    ASSERT_EQ(loaded.uniqueCount(), original.uniqueCount());
+    for (size_t i = 0; i < original.entries().size(); ++i) {
+        EXPECT_EQ(loaded.entries()[i].code, original.entries()[i].code);
+        EXPECT_EQ(loaded.entries()[i].count, original.entries()[i].count);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST(KMerSerializationTest, CounterRoundTrip) {
+    KMerCounter counter(5);
+    counter.countRaw("ACGTACGTACGTTTTTAAAAA");
+
+    auto path = tempProfilePath("counter");
+    counter.save(path);
+
+    KMerCounter loaded = KMerCounter::load(path);
+
+    EXPECT_EQ(loaded.k(), counter.k());
+    EXPECT_EQ(loaded.totalCount(), counter.totalCount());
+    ASSERT_EQ(loaded.uniqueCount(), counter.uniqueCount());
+    for (const auto& [kmer, count] : counter) {
+        EXPECT_EQ(loaded.getCount(kmer), count);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST(KMerSerializationTest, CanonicalCounterRoundTrip) {
+    CanonicalKMerCounter counter(3);
+    counter.count(Sequence("ACGTTTGCA", "read"));
+
+    auto path = tempProfilePath("canonical");
+    counter.save(path);
+
+    CanonicalKMerCounter loaded = CanonicalKMerCounter::load(path);
+
+    EXPECT_EQ(loaded.k(), counter.k());
+    EXPECT_EQ(loaded.totalCount(), counter.totalCount());
+    EXPECT_EQ(loaded.uniqueCount(), counter.uniqueCount());
+    EXPECT_EQ(loaded.getCount("ACG"), counter.getCount("ACG"));
+
+    std::filesystem::remove(path);
+}
+
+TEST(KMerSerializationTest, MalformedFilesThrow) {
+    auto path = tempProfilePath("malformed");
+
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "not a profile";
+    }
+    EXPECT_THROW((void)KMerProfile::load(path), KMerError);
+
+    // Valid header magic but truncated payload
+    KMerCounter counter(3);
+    counter.countRaw("ACGTACGT");
+    counter.save(path);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+    EXPECT_THROW((void)KMerProfile::load(path), KMerError);
+
+    std::filesystem::remove(path);
+}
+
+// ============================================================================
+// Fixed-K Counter Tests
+// ============================================================================
+
+TEST(FixedKMerCounterTest, MatchesRuntimeCounter) {
+    std::string bases;
+    std::mt19937 rng(91);
+    for (size_t i = 0; i < 5000; ++i) {
+        bases += "ACGT"[rng() % 4];
+    }
+
+    EncodedKMerCounter runtime(21);
+    runtime.countRaw(bases);
+
+    FixedKMerCounter<21> fixed;
+    fixed.countRaw(bases);
+
+    EXPECT_EQ(fixed.k(), 21u);
+    EXPECT_EQ(fixed.uniqueCount(), runtime.uniqueCount());
+    EXPECT_EQ(fixed.totalCount(), runtime.totalCount());
+    EXPECT_EQ(fixed.getCount(bases.substr(100, 21)),
+              runtime.getCount(bases.substr(100, 21)));
+}
+
+TEST(FixedKMerCounterTest, FixedScanLoopsMatchRuntimeLoops) {
+    std::string bases = "ACGTNACGTACGTTGCAACGTNNACGTACGT";
+
+    std::vector<uint64_t> runtime_codes;
+    forEachKmerCode(bases, 5, [&](uint64_t c) { runtime_codes.push_back(c); });
+    std::vector<uint64_t> fixed_codes;
+    forEachKmerCode<5>(bases, [&](uint64_t c) { fixed_codes.push_back(c); });
+    EXPECT_EQ(fixed_codes, runtime_codes);
+
+    std::vector<uint64_t> runtime_canonical;
+    forEachCanonicalKmerCode(bases, 5, [&](uint64_t c) {
+        runtime_canonical.push_back(c);
+    });
+    std::vector<uint64_t> fixed_canonical;
+    forEachCanonicalKmerCode<5>(bases, [&](uint64_t c) {
+        fixed_canonical.push_back(c);
+    });
+    EXPECT_EQ(fixed_canonical, runtime_canonical);
+}
+
+TEST(FixedKMerCounterTest, DispatchCoversProductionKValues) {
+    for (size_t k : {15, 21, 25, 31}) {
+        size_t dispatched = 0;
+        EXPECT_TRUE(withFixedKmerLength(k, [&](auto fixed_k) {
+            dispatched = fixed_k();
+        }));
+        EXPECT_EQ(dispatched, k);
+    }
+
+    EXPECT_FALSE(withFixedKmerLength(20, [](auto) {}));
+    EXPECT_FALSE(withFixedKmerLength(0, [](auto) {}));
+}
+
+TEST(FixedKMerCounterTest, UnderlyingCounterMerges) {
+    FixedKMerCounter<15> fixed;
+    fixed.countRaw("ACGTACGTACGTACGTACGT");
+
+    EncodedKMerCounter merged(15);
+    merged.merge(fixed.underlying());
+
+    EXPECT_EQ(merged.totalCount(), fixed.totalCount());
+    EXPECT_EQ(merged.uniqueCount(), fixed.uniqueCount());
+}
+
+// ============================================================================
+// ConcurrentKMerCounter Tests
+// ============================================================================
+
+TEST(ConcurrentKMerCounterTest, MatchesSerialCounter) {
+    std::mt19937 rng(41);
+    std::string bases;
+    for (size_t i = 0; i < 2000; ++i) {
+        bases += "ACGT"[rng() % 4];
+    }
+
+    EncodedKMerCounter serial(21);
+    serial.countRaw(bases);
+
+    ConcurrentKMerCounter concurrent(21, 4000);
+    concurrent.countRaw(bases);
+
+    EXPECT_EQ(concurrent.uniqueCount(), serial.uniqueCount());
+    EXPECT_EQ(concurrent.totalCount(), serial.totalCount());
+    serial.forEach([&](uint64_t code, size_t count) {
+        EXPECT_EQ(concurrent.getCount(code), count);
+    });
+}
+
+TEST(ConcurrentKMerCounterTest, StringQueriesMatchCounterSemantics) {
+    ConcurrentKMerCounter counter(4, 100);
+    counter.countRaw("ACGTACGT");
+
+    EXPECT_EQ(counter.getCount("ACGT"), 2u);
+    EXPECT_TRUE(counter.contains("CGTA"));
+    EXPECT_EQ(counter.getCount("AAAA"), 0u);
+    EXPECT_EQ(counter.getCount("ACG"), 0u);    // wrong length
+    EXPECT_EQ(counter.getCount("ACGN"), 0u);   // ambiguous base
+}
+
+TEST(ConcurrentKMerCounterTest, ParallelInsertsAgreeWithSerial) {
+    std::mt19937 rng(43);
+    std::vector<std::string> chunks;
+    for (size_t c = 0; c < 8; ++c) {
+        std::string bases;
+        for (size_t i = 0; i < 1000; ++i) {
+            bases += "ACGT"[rng() % 4];
+        }
+        chunks.push_back(std::move(bases));
+    }
+
+    EncodedKMerCounter serial(15);
+    for (const auto& chunk : chunks) {
+        serial.countRaw(chunk);
+    }
+
+    ConcurrentKMerCounter concurrent(15, 16000);
+    std::vector<std::thread> writers;
+    for (size_t t = 0; t < 4; ++t) {
+        writers.emplace_back([&, t] {
+            for (size_t c = t; c < chunks.size(); c += 4) {
+                concurrent.countRaw(chunks[c]);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    EXPECT_EQ(concurrent.uniqueCount(), serial.uniqueCount());
+    EXPECT_EQ(concurrent.totalCount(), serial.totalCount());
+    serial.forEach([&](uint64_t code, size_t count) {
+        EXPECT_EQ(concurrent.getCount(code), count);
+    });
+}
+
+TEST(ConcurrentKMerCounterTest, ReadsRunConcurrentlyWithInserts) {
+    std::mt19937 rng(47);
+    std::string panel;
+    for (size_t i = 0; i < 5000; ++i) {
+        panel += "ACGT"[rng() % 4];
+    }
+
+    ConcurrentKMerCounter counter(21, 10000);
+    std::atomic<bool> done{false};
+    std::atomic<size_t> hits{0};
+
+    std::thread reader([&] {
+        // Counts only ever grow, so any value read mid-insert is valid
+        while (!done.load()) {
+            hits += counter.getCount(panel.substr(100, 21)) > 0;
+        }
+    });
+
+    counter.countRaw(panel);
+    done.store(true);
+    reader.join();
+
+    EXPECT_GT(counter.getCount(panel.substr(100, 21)), 0u);
+}
+
+TEST(ConcurrentKMerCounterTest, ThrowsWhenFull) {
+    ConcurrentKMerCounter counter(15, 16);
+
+    std::mt19937 rng(53);
+    EXPECT_THROW(
+        {
+            for (size_t i = 0; i < 10000; ++i) {
+                counter.add(rng() % (uint64_t{1} << 30), 1);
+            }
+        },
+        KMerError);
+}
+
+TEST(ConcurrentKMerCounterTest, RejectsK32) {
+    EXPECT_THROW(ConcurrentKMerCounter(32, 100), KMerError);
+    EXPECT_THROW(ConcurrentKMerCounter(0, 100), KMerError);
+}
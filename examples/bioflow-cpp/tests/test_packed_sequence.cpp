@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "bioflow/packed_sequence.hpp"
+
+using namespace bioflow;
+
+static_assert(SequenceLike<PackedSequence>,
+              "PackedSequence must satisfy the SequenceLike concept");
+
+// ============================================================================
+// Constructor Tests
+// ============================================================================
+
+TEST(PackedSequenceTest, ConstructorWithValidBases) {
+    EXPECT_NO_THROW(PackedSequence("ATCG"));
+    EXPECT_NO_THROW(PackedSequence("atcg"));
+    EXPECT_NO_THROW(PackedSequence("AtCgN"));
+}
+
+TEST(PackedSequenceTest, ConstructorThrowsOnEmptySequence) {
+    EXPECT_THROW(PackedSequence(""), SequenceError);
+}
+
+TEST(PackedSequenceTest, ConstructorThrowsOnInvalidBase) {
+    EXPECT_THROW(PackedSequence("ATXCG"), SequenceError);
+    EXPECT_THROW(PackedSequence("123"), SequenceError);
+}
+
+TEST(PackedSequenceTest, ConstructorWithId) {
+    PackedSequence seq("ATCG", "test_id");
+    ASSERT_TRUE(seq.id().has_value());
+    EXPECT_EQ(*seq.id(), "test_id");
+}
+
+TEST(PackedSequenceTest, ConstructorFromSequence) {
+    Sequence seq("ACGTNACGT", "packed");
+    PackedSequence packed(seq);
+    EXPECT_EQ(packed.bases(), seq.bases());
+    EXPECT_EQ(packed.id(), seq.id());
+}
+
+// ============================================================================
+// Round-Trip Tests
+// ============================================================================
+
+TEST(PackedSequenceTest, RoundTripShort) {
+    PackedSequence seq("acgt");
+    EXPECT_EQ(seq.bases(), "ACGT");
+    EXPECT_EQ(seq.length(), 4);
+}
+
+TEST(PackedSequenceTest, RoundTripAcrossWordBoundary) {
+    // 70 bases spans three 32-base words
+    std::string bases = "ACGTACGTACGTACGTACGTACGTACGTACGT"
+                        "ACGTACGTACGTACGTACGTACGTACGTACGT"
+                        "ACGTAN";
+    PackedSequence seq(bases);
+    EXPECT_EQ(seq.bases(), bases);
+}
+
+TEST(PackedSequenceTest, ElementAccess) {
+    PackedSequence seq("ACGTN");
+    EXPECT_EQ(seq[0], 'A');
+    EXPECT_EQ(seq[1], 'C');
+    EXPECT_EQ(seq[2], 'G');
+    EXPECT_EQ(seq[3], 'T');
+    EXPECT_EQ(seq[4], 'N');
+    EXPECT_THROW(seq.at(5), std::out_of_range);
+}
+
+TEST(PackedSequenceTest, Unpack) {
+    PackedSequence packed("ACGTNACGT", "id1");
+    Sequence seq = packed.unpack();
+    EXPECT_EQ(seq.bases(), "ACGTNACGT");
+    ASSERT_TRUE(seq.id().has_value());
+    EXPECT_EQ(*seq.id(), "id1");
+}
+
+// ============================================================================
+// Content Analysis Tests
+// ============================================================================
+
+TEST(PackedSequenceTest, GCContentMatchesSequence) {
+    std::string bases = "ATCGGGCCCGATNNATCGTTACGATCGATCGGCGCTAGCAT";
+    Sequence reference(bases);
+    PackedSequence packed(bases);
+    EXPECT_DOUBLE_EQ(packed.gcContent(), reference.gcContent());
+    EXPECT_DOUBLE_EQ(packed.atContent(), reference.atContent());
+}
+
+TEST(PackedSequenceTest, BaseCompositionMatchesSequence) {
+    std::string bases = "AACCGGTTNNACGTACGTACGTACGTACGTACGTACGTA";
+    Sequence reference(bases);
+    PackedSequence packed(bases);
+    EXPECT_EQ(packed.baseComposition(), reference.baseComposition());
+}
+
+TEST(PackedSequenceTest, CountBase) {
+    PackedSequence seq("AACCCGGGGN");
+    EXPECT_EQ(seq.countBase('A'), 2);
+    EXPECT_EQ(seq.countBase('C'), 3);
+    EXPECT_EQ(seq.countBase('G'), 4);
+    EXPECT_EQ(seq.countBase('T'), 0);
+    EXPECT_EQ(seq.countBase('N'), 1);
+}
+
+TEST(PackedSequenceTest, HasAmbiguousBases) {
+    EXPECT_FALSE(PackedSequence("ACGT").hasAmbiguousBases());
+    EXPECT_TRUE(PackedSequence("ACGNT").hasAmbiguousBases());
+}
+
+// ============================================================================
+// Transformation Tests
+// ============================================================================
+
+TEST(PackedSequenceTest, ComplementMatchesSequence) {
+    std::string bases = "ATCGNATCGGGTTTAAACCCGGGATCGATCGATCGATCGAT";
+    EXPECT_EQ(PackedSequence(bases).complement().bases(),
+              Sequence(bases).complement().bases());
+}
+
+TEST(PackedSequenceTest, ReverseComplementMatchesSequence) {
+    std::string bases = "ATCGNATCGGGTTTAAACCCGGGATCGATCGATCGATCGAT";
+    EXPECT_EQ(PackedSequence(bases).reverseComplement().bases(),
+              Sequence(bases).reverseComplement().bases());
+}
+
+TEST(PackedSequenceTest, ReverseComplementWordAligned) {
+    // Exactly 32 bases: no tail padding in the packed word
+    std::string bases = "ACGTACGTACGTACGTACGTACGTACGTACGT";
+    EXPECT_EQ(PackedSequence(bases).reverseComplement().bases(),
+              Sequence(bases).reverseComplement().bases());
+}
+
+TEST(PackedSequenceTest, Subsequence) {
+    std::string bases = "ACGTACGTACGTACGTACGTACGTACGTACGTNACGTACGT";
+    Sequence reference(bases);
+    PackedSequence packed(bases);
+
+    EXPECT_EQ(packed.subsequence(3, 10).bases(),
+              reference.subsequence(3, 10).bases());
+    EXPECT_EQ(packed.subsequence(30, 8).bases(),
+              reference.subsequence(30, 8).bases());
+    EXPECT_THROW(packed.subsequence(100, 5), SequenceError);
+}
+
+// ============================================================================
+// Storage Tests
+// ============================================================================
+
+TEST(PackedSequenceTest, MemoryUsageIsPacked) {
+    std::string bases(1024, 'A');
+    PackedSequence packed(bases);
+    // 2 bits/base packed + 1 bit/base N-mask vs 8 bits/base as a string
+    EXPECT_LE(packed.memoryUsage(), bases.size() / 2);
+}
+
+TEST(PackedSequenceTest, Equality) {
+    EXPECT_EQ(PackedSequence("ACGT"), PackedSequence("acgt"));
+    EXPECT_FALSE(PackedSequence("ACGT") == PackedSequence("ACGA"));
+    EXPECT_FALSE(PackedSequence("ACGT") == PackedSequence("ACGN"));
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include "bioflow/pipeline.hpp"
+
+#include <string>
+#include <thread>
+
+using namespace bioflow;
+
+namespace {
+
+// Builds a FASTQ record with uniform quality
+std::string makeRecord(const std::string& id, const std::string& bases, char qual) {
+    return "@" + id + "\n" + bases + "\n+\n" + std::string(bases.size(), qual) + "\n";
+}
+
+} // namespace
+
+// ============================================================================
+// BoundedQueue Tests
+// ============================================================================
+
+TEST(BoundedQueueTest, PreservesFifoOrder) {
+    BoundedQueue<int> queue(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.push(i));
+    }
+    queue.close();
+
+    for (int i = 0; i < 4; ++i) {
+        auto item = queue.pop();
+        ASSERT_TRUE(item.has_value());
+        EXPECT_EQ(*item, i);
+    }
+    EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(BoundedQueueTest, PushAfterCloseFails) {
+    BoundedQueue<int> queue(2);
+    queue.close();
+    EXPECT_FALSE(queue.push(1));
+    EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(BoundedQueueTest, BlockingHandoffAcrossThreads) {
+    BoundedQueue<int> queue(2);  // smaller than the item count
+    constexpr int kItems = 100;
+
+    std::thread producer([&]() {
+        for (int i = 0; i < kItems; ++i) {
+            ASSERT_TRUE(queue.push(i));
+        }
+        queue.close();
+    });
+
+    int received = 0;
+    while (auto item = queue.pop()) {
+        EXPECT_EQ(*item, received);
+        received++;
+    }
+    producer.join();
+
+    EXPECT_EQ(received, kItems);
+}
+
+// ============================================================================
+// FastqPipeline Tests
+// ============================================================================
+
+TEST(FastqPipelineTest, DeliversEveryRecordWithoutFiltering) {
+    std::string input;
+    for (int i = 0; i < 25; ++i) {
+        input += makeRecord("read" + std::to_string(i), "ACGTACGTAC", 'I');
+    }
+
+    PipelineConfig config;
+    config.batch_size = 4;
+    config.worker_threads = 2;
+
+    FastqPipeline pipeline{std::string_view(input), config};
+
+    size_t delivered = 0;
+    auto stats = pipeline.run([&](RecordBatch&& batch) {
+        delivered += batch.size();
+    });
+
+    EXPECT_EQ(delivered, 25u);
+    EXPECT_EQ(stats.records_parsed, 25u);
+    EXPECT_EQ(stats.records_passed, 25u);
+    EXPECT_EQ(stats.bases_parsed, 250u);
+    EXPECT_EQ(stats.bases_passed, 250u);
+    EXPECT_DOUBLE_EQ(stats.passRate(), 1.0);
+}
+
+TEST(FastqPipelineTest, FiltersLowQualityRecords) {
+    // 'I' is Q40, '#' is Q2
+    std::string input = makeRecord("good", "ACGTACGTAC", 'I') +
+                        makeRecord("bad", "ACGTACGTAC", '#') +
+                        makeRecord("good2", "ACGTACGTAC", 'I');
+
+    PipelineConfig config;
+    config.min_mean_quality = 20.0;
+    config.worker_threads = 2;
+
+    FastqPipeline pipeline{std::string_view(input), config};
+
+    size_t delivered = 0;
+    auto stats = pipeline.run([&](RecordBatch&& batch) {
+        delivered += batch.size();
+        for (const auto& record : batch) {
+            EXPECT_NE(record.id, "bad");
+        }
+    });
+
+    EXPECT_EQ(delivered, 2u);
+    EXPECT_EQ(stats.records_parsed, 3u);
+    EXPECT_EQ(stats.records_passed, 2u);
+}
+
+TEST(FastqPipelineTest, TrimmingShortensRecords) {
+    // High-quality prefix, low-quality tail
+    std::string quality = std::string(6, 'I') + std::string(4, '#');
+    std::string input = "@read0\nACGTACGTAC\n+\n" + quality + "\n";
+
+    PipelineConfig config;
+    config.trim_quality = 20;
+
+    FastqPipeline pipeline{std::string_view(input), config};
+
+    size_t kept_bases = 0;
+    auto stats = pipeline.run([&](RecordBatch&& batch) {
+        for (const auto& record : batch) {
+            kept_bases += record.length();
+        }
+    });
+
+    EXPECT_EQ(stats.bases_parsed, 10u);
+    EXPECT_EQ(kept_bases, 6u);
+    EXPECT_EQ(stats.bases_passed, 6u);
+}
+
+TEST(FastqPipelineTest, CountKmersMatchesDirectCounting) {
+    std::string input;
+    std::vector<QualifiedSequence> records;
+    const std::string bases = "ACGTTGCAACGTGGCATTAGCCGA";
+    for (int i = 0; i < 10; ++i) {
+        input += makeRecord("read" + std::to_string(i), bases, 'I');
+    }
+
+    PipelineConfig config;
+    config.batch_size = 3;
+    config.worker_threads = 2;
+
+    FastqPipeline pipeline{std::string_view(input), config};
+    auto [counter, stats] = pipeline.countKmers(5);
+
+    CanonicalKMerCounter reference(5);
+    for (int i = 0; i < 10; ++i) {
+        reference.count(Sequence(bases, "read"));
+    }
+
+    EXPECT_EQ(stats.records_passed, 10u);
+    EXPECT_EQ(counter.totalCount(), reference.totalCount());
+    EXPECT_EQ(counter.uniqueCount(), reference.uniqueCount());
+}
+
+TEST(FastqPipelineTest, SinkExceptionPropagates) {
+    std::string input;
+    for (int i = 0; i < 50; ++i) {
+        input += makeRecord("read" + std::to_string(i), "ACGTACGTAC", 'I');
+    }
+
+    PipelineConfig config;
+    config.batch_size = 2;
+
+    FastqPipeline pipeline{std::string_view(input), config};
+
+    EXPECT_THROW(
+        pipeline.run([](RecordBatch&&) {
+            throw std::runtime_error("sink failed");
+        }),
+        std::runtime_error);
+}
+
+TEST(FastqPipelineTest, MalformedInputSurfacesIOError) {
+    std::string input = "@read0\nACGT\nnot-a-separator\nIIII\n";
+
+    FastqPipeline pipeline{std::string_view(input)};
+    EXPECT_THROW(pipeline.run([](RecordBatch&&) {}), IOError);
+}
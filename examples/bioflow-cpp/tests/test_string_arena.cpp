@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "bioflow/string_arena.hpp"
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace bioflow;
+
+// ============================================================================
+// StringArena Tests
+// ============================================================================
+
+TEST(StringArenaTest, InternedViewsStayStableAcrossGrowth) {
+    StringArena arena(64);  // tiny blocks to force frequent growth
+
+    std::vector<std::string_view> views;
+    for (int i = 0; i < 1000; ++i) {
+        views.push_back(arena.intern("read_" + std::to_string(i)));
+    }
+
+    ASSERT_GT(arena.blockCount(), 1u);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(views[i], "read_" + std::to_string(i));
+    }
+}
+
+TEST(StringArenaTest, OversizedStringGetsItsOwnBlock) {
+    StringArena arena(16);
+    std::string long_id(100, 'x');
+
+    std::string_view view = arena.intern(long_id);
+    EXPECT_EQ(view, long_id);
+    EXPECT_EQ(arena.bytesStored(), 100u);
+}
+
+TEST(StringArenaTest, EmptyStringCostsNothing) {
+    StringArena arena;
+    EXPECT_EQ(arena.intern(""), "");
+    EXPECT_EQ(arena.blockCount(), 0u);
+    EXPECT_EQ(arena.bytesStored(), 0u);
+}
+
+TEST(StringArenaTest, TracksBytesStored) {
+    StringArena arena;
+    (void)arena.intern("abc");
+    (void)arena.intern("defgh");
+    EXPECT_EQ(arena.bytesStored(), 8u);
+}
+
+// ============================================================================
+// InternedString Tests
+// ============================================================================
+
+TEST(InternedStringTest, OwnedAndBorrowedCompareByValue) {
+    StringArena arena;
+    InternedString owned{std::string("read42")};
+    InternedString borrowed = InternedString::borrowed(arena.intern("read42"));
+
+    EXPECT_FALSE(owned.isBorrowed());
+    EXPECT_TRUE(borrowed.isBorrowed());
+    EXPECT_EQ(owned, borrowed);
+    EXPECT_EQ(borrowed, "read42");
+    EXPECT_NE(borrowed, "read43");
+}
+
+TEST(InternedStringTest, ConvertsAndPrintsLikeAString) {
+    InternedString id = "chr1";
+    EXPECT_EQ(std::string_view(id), "chr1");
+    EXPECT_EQ(id.str(), "chr1");
+    EXPECT_EQ(id.size(), 4u);
+    EXPECT_FALSE(id.empty());
+
+    std::ostringstream os;
+    os << id;
+    EXPECT_EQ(os.str(), "chr1");
+}
+
+TEST(InternedStringTest, DefaultIsEmpty) {
+    InternedString id;
+    EXPECT_TRUE(id.empty());
+    EXPECT_EQ(id, "");
+}
+
+TEST(InternedStringTest, OrdersLexicographically) {
+    InternedString a = "apple";
+    InternedString b = "banana";
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(b > a);
+}